@@ -0,0 +1,60 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts the heap allocations made through the C++ operator new, from every
+// thread of the process. Allocations the middleware core makes in C (malloc)
+// are not included.
+//
+// This replaces the global operator new and delete, which a program may only
+// do once: include this header from a single translation unit of each
+// executable, its main file.
+namespace allocation_counter {
+
+    inline std::atomic<unsigned long long>& counter()
+    {
+        static std::atomic<unsigned long long> allocations(0);
+        return allocations;
+    }
+
+    inline unsigned long long allocations()
+    {
+        return counter().load(std::memory_order_relaxed);
+    }
+
+}  // namespace allocation_counter
+
+void *operator new(std::size_t size)
+{
+    allocation_counter::counter().fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif  // ALLOCATION_COUNTER_HPP
@@ -13,11 +13,14 @@
 #ifndef APPLICATION_HPP
 #define APPLICATION_HPP
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <csignal>
 #include <dds/core/ddscore.hpp>
 
+#include "stats_report.hpp"
+
 #define STR_ME( x ) ( # x )
 
 namespace colours {
@@ -47,6 +50,66 @@ namespace colours {
     };
 
     inline Enum &operator++(Enum &e) { return e = Enum(e + 1); }
+
+    // Key used for the n-th instance published by this process. The first
+    // instance uses the requested colour, the following ones rotate through the
+    // remaining colours and get a numeric suffix once all colours are used, e.g.
+    // BLUE, RED, ..., PURPLE, BLUE_1, RED_1, ...
+    inline std::string instance_key(const std::string& color, unsigned int index)
+    {
+        int first = colours::BLUE;
+        for (int c = colours::MIN_COLOUR; c != colours::MAX_COLOUR; c++) {
+            if (0 == color.compare(colours::ToStr[c])) {
+                first = c;
+                break;
+            }
+        }
+
+        std::string key = colours::ToStr[(first + index) % colours::MAX_COLOUR];
+        if (index >= colours::MAX_COLOUR)
+            key += "_" + std::to_string(index / colours::MAX_COLOUR);
+
+        return key;
+    }
+
+    // Numeric id of an instance key, for types keyed by an id. It only
+    // depends on the key, so every process gives a key the same id: the
+    // keys instance_key() builds map to colour + MAX_COLOUR * suffix (BLUE
+    // is 1, RED_2 is 2 + 8 * 2), below 2^31. Any other key gets a hash with
+    // the top bit set, which cannot take the id of one of those.
+    inline uint32_t instance_id(const std::string& key)
+    {
+        for (int c = colours::MIN_COLOUR; c != colours::MAX_COLOUR; c++) {
+            const std::string& name = colours::ToStr[c];
+            if (0 != key.compare(0, name.size(), name))
+                continue;
+            if (key.size() == name.size())
+                return (uint32_t) c;
+
+            // Only "_<n>" with n > 0 and no leading zero, as instance_key()
+            // writes it, so that no two keys get the same id
+            size_t i = name.size();
+            if (key[i] != '_' || i + 1 == key.size() || key[i + 1] == '0')
+                break;
+            uint64_t suffix = 0;
+            for (++i; i < key.size() && key[i] >= '0' && key[i] <= '9'; ++i) {
+                suffix = suffix * 10 + (key[i] - '0');
+                if (c + colours::MAX_COLOUR * suffix >= 0x80000000u)
+                    break;
+            }
+            if (i == key.size())
+                return (uint32_t) (c + colours::MAX_COLOUR * suffix);
+            break;
+        }
+
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        for (char ch : key) {
+            hash ^= (unsigned char) ch;
+            hash *= 16777619u;
+        }
+        return hash | 0x80000000u;
+    }
 };
 
 namespace application {
@@ -77,6 +140,25 @@ namespace application {
         unsigned int domain_id;
         unsigned int sample_count;
         std::string color; 
+        unsigned int instance_count;
+        double rate;
+        unsigned int log_every;
+        double frame_rate;
+        unsigned int log_depth;
+        bool headless;
+        stats_report::Format stats_format;
+        double stats_period;
+        std::string role;
+        std::string transport;
+        std::string qos_profile;
+        bool write_with_handle;
+        bool flush_per_frame;
+        std::string data_type;
+        std::string data_representation;
+        unsigned int drain_per_instance;
+        unsigned int drain_per_dispatch;
+        bool state;
+        std::string filter;
         rti::config::Verbosity verbosity;
 
         ApplicationArguments(
@@ -84,11 +166,49 @@ namespace application {
             unsigned int domain_id_param,
             unsigned int sample_count_param,
             std::string color_param,
+            unsigned int instance_count_param,
+            double rate_param,
+            unsigned int log_every_param,
+            double frame_rate_param,
+            unsigned int log_depth_param,
+            bool headless_param,
+            stats_report::Format stats_format_param,
+            double stats_period_param,
+            std::string role_param,
+            std::string transport_param,
+            std::string qos_profile_param,
+            bool write_with_handle_param,
+            bool flush_per_frame_param,
+            std::string data_type_param,
+            std::string data_representation_param,
+            unsigned int drain_per_instance_param,
+            unsigned int drain_per_dispatch_param,
+            bool state_param,
+            std::string filter_param,
             rti::config::Verbosity verbosity_param)
             : parse_result(parse_result_param),
             domain_id(domain_id_param),
             sample_count(sample_count_param),
             color(color_param),
+            instance_count(instance_count_param),
+            rate(rate_param),
+            log_every(log_every_param),
+            frame_rate(frame_rate_param),
+            log_depth(log_depth_param),
+            headless(headless_param),
+            stats_format(stats_format_param),
+            stats_period(stats_period_param),
+            role(role_param),
+            transport(transport_param),
+            qos_profile(qos_profile_param),
+            write_with_handle(write_with_handle_param),
+            flush_per_frame(flush_per_frame_param),
+            data_type(data_type_param),
+            data_representation(data_representation_param),
+            drain_per_instance(drain_per_instance_param),
+            drain_per_dispatch(drain_per_dispatch_param),
+            state(state_param),
+            filter(filter_param),
             verbosity(verbosity_param) {}
     };
 
@@ -137,6 +257,25 @@ namespace application {
         unsigned int domain_id = 0;
         std::string color = colours::ToStr[colours::BLUE];
         unsigned int sample_count = (std::numeric_limits<unsigned int>::max)();
+        unsigned int instance_count = 1;
+        double rate = -1.0; // one sample per instance per second
+        unsigned int log_every = 1;
+        double frame_rate = 30.0;
+        unsigned int log_depth = 5;
+        bool headless = false;
+        stats_report::Format stats_format = stats_report::Format::json;
+        double stats_period = 1.0;
+        std::string role = "";  // each tool has its own default
+        std::string transport = "shmem";
+        std::string qos_profile = "";
+        bool write_with_handle = false;
+        bool flush_per_frame = false;
+        std::string data_type = "extended";
+        std::string data_representation = "";
+        unsigned int drain_per_instance = 0;
+        unsigned int drain_per_dispatch = 1000;
+        bool state = false;
+        std::string filter = "";
         rti::config::Verbosity verbosity(rti::config::Verbosity::EXCEPTION);
 
         while (arg_processing < argc) {
@@ -157,6 +296,115 @@ namespace application {
                 set_color(color, argv[arg_processing + 1]);
                 arg_processing += 2;
             } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-i") == 0
+            || strcmp(argv[arg_processing], "--instances") == 0)) {
+                // Parsed signed, a negative count would wrap to a huge
+                // unsigned one
+                int count = atoi(argv[arg_processing + 1]);
+                instance_count = count < 1 ? 1 : count;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-r") == 0
+            || strcmp(argv[arg_processing], "--rate") == 0)) {
+                rate = atof(argv[arg_processing + 1]);
+                if (rate < 0)
+                    rate = 0;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-l") == 0
+            || strcmp(argv[arg_processing], "--log-every") == 0)) {
+                // Parsed signed, a negative interval would wrap to a huge
+                // one; it logs nothing, like 0
+                int every = atoi(argv[arg_processing + 1]);
+                log_every = every < 0 ? 0 : every;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-f") == 0
+            || strcmp(argv[arg_processing], "--fps") == 0)) {
+                frame_rate = atof(argv[arg_processing + 1]);
+                if (frame_rate <= 0)
+                    frame_rate = 30.0;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--log-depth") == 0) {
+                int depth = atoi(argv[arg_processing + 1]);
+                log_depth = depth < 1 ? 1 : depth;
+                arg_processing += 2;
+            } else if (strcmp(argv[arg_processing], "--headless") == 0) {
+                headless = true;
+                arg_processing += 1;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--stats-format") == 0) {
+                if (strcmp(argv[arg_processing + 1], "csv") == 0)
+                    stats_format = stats_report::Format::csv;
+                else
+                    stats_format = stats_report::Format::json;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--stats-period") == 0) {
+                stats_period = atof(argv[arg_processing + 1]);
+                if (stats_period <= 0)
+                    stats_period = 1.0;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--role") == 0) {
+                role = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--transport") == 0) {
+                transport = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && (strcmp(argv[arg_processing], "-q") == 0
+            || strcmp(argv[arg_processing], "--qos-profile") == 0)) {
+                qos_profile = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if (strcmp(argv[arg_processing], "--write-with-handle") == 0) {
+                write_with_handle = true;
+                arg_processing += 1;
+            } else if (strcmp(argv[arg_processing], "--flush-per-frame") == 0) {
+                flush_per_frame = true;
+                arg_processing += 1;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--data-type") == 0) {
+                data_type = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--data-representation") == 0) {
+                data_representation = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--drain-per-instance") == 0) {
+                // Parsed signed: a negative count would wrap to a huge
+                // unsigned one, and take() needs it to fit an int32_t
+                int count = atoi(argv[arg_processing + 1]);
+                if (count < 0) {
+                    std::cout << "Bad parameter: --drain-per-instance must be 0 or more." << std::endl;
+                    show_usage = true;
+                    parse_result = ParseReturn::failure;
+                    break;
+                }
+                drain_per_instance = count;
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--drain-per-dispatch") == 0) {
+                int count = atoi(argv[arg_processing + 1]);
+                if (count < 0) {
+                    std::cout << "Bad parameter: --drain-per-dispatch must be 0 or more." << std::endl;
+                    show_usage = true;
+                    parse_result = ParseReturn::failure;
+                    break;
+                }
+                drain_per_dispatch = count;
+                arg_processing += 2;
+            } else if (strcmp(argv[arg_processing], "--state") == 0) {
+                state = true;
+                arg_processing += 1;
+            } else if ((argc > arg_processing + 1)
+            && strcmp(argv[arg_processing], "--filter") == 0) {
+                filter = argv[arg_processing + 1];
+                arg_processing += 2;
+            } else if ((argc > arg_processing + 1)
             && (strcmp(argv[arg_processing], "-v") == 0
             || strcmp(argv[arg_processing], "--verbosity") == 0)) {
                 set_verbosity(verbosity, atoi(argv[arg_processing + 1]));
@@ -184,13 +432,76 @@ namespace application {
             "                               Default: infinite\n"
             "    -c, --color      <string>  Colour of square\n"\
             "                               Default: BLUE\n"\
+            "    -i, --instances    <int>   Number of keyed instances to publish\n"\
+            "                               through a single DataWriter. The\n"\
+            "                               colour is used for the first one.\n"\
+            "                               Default: 1\n"\
+            "    -r, --rate       <float>   Samples per second to write across\n"\
+            "                               all instances, 0 to write as fast\n"\
+            "                               as possible.\n"\
+            "                               Default: 1 per instance\n"\
+            "    -l, --log-every    <int>   Log every Nth sample, 0 for none.\n"\
+            "                               Default: 1\n"\
+            "    -f, --fps        <float>   Subscriber screen refresh rate.\n"\
+            "                               Default: 30\n"\
+            "    --log-depth        <int>   Lines in the subscriber log area.\n"\
+            "                               Default: 5\n"\
+            "    --headless                 Run the subscriber without ncurses,\n"\
+            "                               printing statistics to stdout.\n"\
+            "    --stats-format   <string>  json or csv.\n"\
+            "                               Default: json\n"\
+            "    --stats-period   <float>   Seconds between statistics lines.\n"\
+            "                               Default: 1\n"\
+            "    --role           <string>  shapes_latency side: ping or pong,\n"\
+            "                               shapes_throughput side: pub or sub.\n"\
+            "                               Default: ping for shapes_latency, pub for\n"\
+            "                               shapes_throughput\n"\
+            "    --transport      <string>  shapes_latency transport: shmem or udp.\n"\
+            "                               Default: shmem\n"\
+            "    -q, --qos-profile <string> QoS profile from USER_QOS_PROFILES.xml,\n"\
+            "                               e.g. shapes_Library::throughput_best_effort.\n"\
+            "                               Default: the default profile\n"\
+            "    --write-with-handle        shapes_throughput: write with the cached\n"\
+            "                               instance handle instead of by key\n"\
+            "    --flush-per-frame          Flush the DataWriter's batch after each\n"\
+            "                               round of instance updates (publisher,\n"\
+            "                               shapes_throughput) or each ping\n"\
+            "    --data-type      <string>  Data type of the publisher, subscriber and\n"\
+            "                               shapes_throughput:\n"\
+            "                               extended (ShapeTypeExtended on Square),\n"\
+            "                               zero_copy (loaned shared-memory samples),\n"\
+            "                               flat_data (FlatData binding) or\n"\
+            "                               compact_key (4-byte id key).\n"\
+            "                               Default: extended\n"\
+            "    --data-representation <string>\n"\
+            "                               xcdr or xcdr2, for every DataWriter and\n"\
+            "                               DataReader (flat_data needs xcdr2).\n"\
+            "                               Default: what the QoS profile sets\n"\
+            "    --drain-per-instance <int> Subscriber: take at most this many samples\n"\
+            "                               from one instance at a time, visiting the\n"\
+            "                               instances in turn. 0 takes everything at once.\n"\
+            "                               Default: 0\n"\
+            "    --drain-per-dispatch <int> With --drain-per-instance, samples taken per\n"\
+            "                               wake-up before the other work gets a turn,\n"\
+            "                               0 for one pass over the instances.\n"\
+            "                               Default: 1000\n"\
+            "    --state                    Subscriber: keep only the newest sample of\n"\
+            "                               each instance (KEEP_LAST 1), with the\n"\
+            "                               shapes_Library::state_reliable profile\n"\
+            "                               unless -q is given\n"\
+            "    --filter         <string>  Subscriber, shapes_throughput sub: only receive\n"\
+            "                               samples matching this SQL expression, e.g.\n"\
+            "                               \"color MATCH 'BLUE*'\" or \"x < 100\".\n"\
+            "                               Default: all samples\n"\
             "    -v, --verbosity    <int>   How much debugging output to show.\n"\
             "                               Range: 0-3 \n"
             "                               Default: 1"
             << std::endl;
         }
 
-        return ApplicationArguments(parse_result, domain_id, sample_count, color, verbosity);
+        return ApplicationArguments(parse_result, domain_id, sample_count, color, instance_count, rate, log_every, frame_rate, log_depth,
+            headless, stats_format, stats_period, role, transport, qos_profile, write_with_handle, flush_per_frame, data_type,
+            data_representation, drain_per_instance, drain_per_dispatch, state, filter, verbosity);
     }
 
 }  // namespace application
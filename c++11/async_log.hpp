@@ -0,0 +1,211 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef ASYNC_LOG_HPP
+#define ASYNC_LOG_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace async_log {
+
+    const size_t LINE_SIZE = 160;
+
+    // Asynchronous log sink.
+    //
+    // Lines are formatted by the caller into a preallocated, bounded ring
+    // buffer of fixed-size lines and handed to the sink by a background
+    // thread (or by the owner through drain()), so the caller never blocks on console I/O and never allocates.
+    // The ring is a lock-free multi-producer / single-consumer queue (each
+    // cell carries a sequence number telling whether it is free or full).
+    // When the ring is full the line is dropped and counted instead of
+    // waiting for the drain thread.
+    class AsyncLog {
+      public:
+        typedef std::function<void(const char *)> Sink;
+        typedef std::function<void()> Flush;
+
+        // capacity is rounded up to a power of two. sample_every controls
+        // sampled(): 1 logs everything, N every Nth call, 0 nothing. Without
+        // a background thread the owner calls drain() itself, e.g. from a
+        // render loop that must be the only thread touching the sink.
+        AsyncLog(
+            size_t capacity,
+            Sink sink,
+            Flush flush = Flush(),
+            unsigned int sample_every = 1,
+            bool background_thread = true)
+            : mask_(round_up_pow2(capacity) - 1),
+            cells_(new Cell[mask_ + 1]),
+            sink_(sink),
+            flush_(flush),
+            sample_every_(sample_every),
+            sample_count_(0),
+            enqueue_pos_(0),
+            dequeue_pos_(0),
+            logged_(0),
+            dropped_(0),
+            sampled_out_(0),
+            stop_(false)
+        {
+            for (size_t i = 0; i <= mask_; ++i)
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+
+            if (background_thread)
+                drain_thread_ = std::thread([this]() { run(); });
+        }
+
+        ~AsyncLog() { stop(); }
+
+        AsyncLog(const AsyncLog&) = delete;
+        AsyncLog& operator=(const AsyncLog&) = delete;
+
+        // Returns true when this call falls on the configured sampling
+        // period. Meant for per-sample lines: if (log.sampled()) log.log(...)
+        bool sampled()
+        {
+            if (sample_every_ == 0
+                    || sample_count_.fetch_add(1, std::memory_order_relaxed) % sample_every_ != 0) {
+                sampled_out_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        // printf-style. Returns false if the line was dropped because the
+        // ring is full. Lines longer than LINE_SIZE are truncated.
+        bool log(const char *format, ...)
+        {
+            size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            Cell *cell;
+            for (;;) {
+                cell = &cells_[pos & mask_];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+                if (diff == 0) {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                } else if (diff < 0) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                } else {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            va_list args;
+            va_start(args, format);
+            vsnprintf(cell->line, LINE_SIZE, format, args);
+            va_end(args);
+
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Drains whatever is left and joins the background thread
+        void stop()
+        {
+            if (!drain_thread_.joinable())
+                return;
+            stop_.store(true, std::memory_order_release);
+            drain_thread_.join();
+        }
+
+        // Hands every complete line to the sink, returns how many there were.
+        // Only one thread may drain at a time.
+        size_t drain()
+        {
+            size_t count = 0;
+            for (;;) {
+                Cell *cell = &cells_[dequeue_pos_ & mask_];
+                if (cell->sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+                    break;
+
+                sink_(cell->line);
+                cell->sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+                ++dequeue_pos_;
+                ++count;
+            }
+
+            if (count > 0) {
+                logged_.fetch_add(count, std::memory_order_relaxed);
+                if (flush_)
+                    flush_();
+            }
+            return count;
+        }
+
+        uint64_t logged() const { return logged_.load(std::memory_order_relaxed); }
+        uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+        uint64_t sampled_out() const { return sampled_out_.load(std::memory_order_relaxed); }
+
+      private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            char line[LINE_SIZE];
+        };
+
+        static size_t round_up_pow2(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+                result <<= 1;
+            return result;
+        }
+
+        void run()
+        {
+            while (!stop_.load(std::memory_order_acquire)) {
+                if (drain() == 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            drain();
+        }
+
+        const size_t mask_;
+        std::unique_ptr<Cell[]> cells_;
+        Sink sink_;
+        Flush flush_;
+        const unsigned int sample_every_;
+        std::atomic<uint64_t> sample_count_;
+        std::atomic<size_t> enqueue_pos_;
+        size_t dequeue_pos_; // only used by the drain thread
+        std::atomic<uint64_t> logged_;
+        std::atomic<uint64_t> dropped_;
+        std::atomic<uint64_t> sampled_out_;
+        std::atomic<bool> stop_;
+        std::thread drain_thread_;
+    };
+
+    // Sink writing each line to stdout, flushed once per drained batch
+    inline AsyncLog::Sink stdout_sink()
+    {
+        return [](const char *line) {
+            fputs(line, stdout);
+            fputc('\n', stdout);
+        };
+    }
+
+    inline AsyncLog::Flush stdout_flush()
+    {
+        return []() { fflush(stdout); };
+    }
+
+}  // namespace async_log
+
+#endif  // ASYNC_LOG_HPP
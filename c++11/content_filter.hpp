@@ -0,0 +1,59 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef CONTENT_FILTER_HPP
+#define CONTENT_FILTER_HPP
+
+#include <string>
+#include <dds/pub/ddspub.hpp>
+#include <dds/sub/ddssub.hpp>
+#include <dds/topic/ddstopic.hpp>
+
+// --filter: DataReaders on a ContentFilteredTopic with an SQL expression, e.g.
+// "color MATCH 'BLUE*'" for some keys or "x < 100" for a region.
+//
+// The reader sends its filter to the DataWriters it matches. A DataWriter
+// that keeps the filter evaluates it before sending, so samples the reader
+// does not want never leave the publisher. This is done for unicast readers
+// and not for batching DataWriters; other samples are filtered on arrival.
+namespace content_filter {
+
+    // A DataReader on topic, or on a ContentFilteredTopic of it when there
+    // is an expression. The reader keeps the filtered topic alive.
+    template <typename T>
+    dds::sub::DataReader<T> create_reader(
+        dds::sub::Subscriber& subscriber,
+        const dds::topic::Topic<T>& topic,
+        const dds::sub::qos::DataReaderQos& qos,
+        const std::string& expression)
+    {
+        if (expression.empty())
+            return dds::sub::DataReader<T>(subscriber, topic, qos);
+
+        dds::topic::ContentFilteredTopic<T> filtered_topic(
+            topic,
+            topic.name() + "Filtered",
+            dds::topic::Filter(expression));
+        return dds::sub::DataReader<T>(subscriber, filtered_topic, qos);
+    }
+
+    // Lets the DataWriter keep the filters of all its readers, instead of
+    // the first 32, so it filters for every one of them
+    inline void enable_writer_filtering(dds::pub::qos::DataWriterQos& qos)
+    {
+        qos.policy<rti::core::policy::DataWriterResourceLimits>()
+            .max_remote_reader_filters(dds::core::LENGTH_UNLIMITED);
+    }
+
+}  // namespace content_filter
+
+#endif  // CONTENT_FILTER_HPP
@@ -0,0 +1,53 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef DATA_REPRESENTATION_HPP
+#define DATA_REPRESENTATION_HPP
+
+#include <stdexcept>
+#include <string>
+#include <dds/core/ddscore.hpp>
+
+// --data-representation: the encoding DataWriters serialize with and the one
+// DataReaders accept. The shape types are extensible, so XCDR1 and XCDR2
+// differ in their encapsulation and padding; writer and reader must be given
+// the same one or they do not match.
+namespace data_representation {
+
+    inline dds::core::policy::DataRepresentationId id(const std::string& name)
+    {
+        if (name == "xcdr")
+            return dds::core::policy::DataRepresentation::xcdr();
+        if (name == "xcdr2")
+            return dds::core::policy::DataRepresentation::xcdr2();
+        throw std::invalid_argument("unknown data representation " + name + ", use xcdr or xcdr2");
+    }
+
+    // Sets the representation of a DataWriterQos or DataReaderQos. An empty
+    // name leaves what the QoS profile set.
+    template <typename Qos>
+    void apply(Qos& qos, const std::string& name)
+    {
+        if (name.empty())
+            return;
+        qos << dds::core::policy::DataRepresentation(dds::core::policy::DataRepresentationIdSeq(1, id(name)));
+    }
+
+    // For reports
+    inline const char *label(const std::string& name)
+    {
+        return name.empty() ? "profile representation" : name.c_str();
+    }
+
+}  // namespace data_representation
+
+#endif  // DATA_REPRESENTATION_HPP
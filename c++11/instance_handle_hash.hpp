@@ -0,0 +1,38 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef INSTANCE_HANDLE_HASH_HPP
+#define INSTANCE_HANDLE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <dds/core/ddscore.hpp>
+
+// Hash functor so dds::core::InstanceHandle can key an std::unordered_map.
+//
+// An instance handle carries the 16-byte key hash of its instance. That is an
+// MD5 for large keys but the raw serialized key for small ones, so all 16
+// bytes go through FNV-1a rather than using the first word as is.
+struct InstanceHandleHash {
+    std::size_t operator()(const dds::core::InstanceHandle& handle) const
+    {
+        const DDS_InstanceHandle_t& native = handle->native();
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned int i = 0; i < sizeof(native.keyHash.value); ++i) {
+            hash ^= native.keyHash.value[i];
+            hash *= 1099511628211ULL;
+        }
+        return (std::size_t) hash;
+    }
+};
+
+#endif  // INSTANCE_HANDLE_HASH_HPP
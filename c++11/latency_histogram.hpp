@@ -0,0 +1,125 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// HDR-style latency histogram with a fixed relative precision.
+//
+// Values below 2^SubBucketBits are counted exactly; above that every power of
+// two is split into 2^(SubBucketBits-1) linear sub-buckets, so the error of a
+// reported percentile is at most 1 / 2^(SubBucketBits-1) of the value (about
+// 1.6% with 7 bits, 6% with 5 bits) whatever its magnitude. Recording is a
+// couple of shifts and an increment. Values are clamped to 2^MAX_BITS, a bit
+// over an hour in microseconds or four seconds in nanoseconds.
+template <unsigned int SubBucketBits = 7>
+class LatencyHistogram {
+  public:
+    static const unsigned int MAX_BITS = 32;
+    static const uint64_t SUB_BUCKET_COUNT = 1ULL << SubBucketBits;
+    static const uint64_t HALF_COUNT = SUB_BUCKET_COUNT / 2;
+
+    LatencyHistogram()
+        : counts_(SUB_BUCKET_COUNT + (MAX_BITS - SubBucketBits) * HALF_COUNT, 0),
+        total_(0),
+        negative_(0),
+        max_(0) {}
+
+    // Negative values (e.g. clocks of two hosts out of sync) are counted
+    // apart and recorded as 0
+    void record(int64_t value)
+    {
+        if (value < 0) {
+            ++negative_;
+            value = 0;
+        }
+        uint64_t v = (uint64_t) value;
+        if (v >= (1ULL << MAX_BITS))
+            v = (1ULL << MAX_BITS) - 1;
+
+        ++counts_[index_of(v)];
+        ++total_;
+        if (v > max_)
+            max_ = v;
+    }
+
+    // Highest value equivalent to the requested percentile (0-100), i.e.
+    // the upper end of the bucket it falls in, capped at the exact max
+    uint64_t percentile(double p) const
+    {
+        if (total_ == 0)
+            return 0;
+
+        uint64_t target = (uint64_t) (p / 100.0 * total_ + 0.5);
+        if (target < 1)
+            target = 1;
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= target) {
+                uint64_t value = highest_of(i);
+                return value < max_ ? value : max_;
+            }
+        }
+        return max_;
+    }
+
+    void reset()
+    {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        total_ = 0;
+        negative_ = 0;
+        max_ = 0;
+    }
+
+    uint64_t count() const { return total_; }
+    uint64_t negative_count() const { return negative_; }
+    uint64_t max() const { return max_; }
+
+  private:
+    static unsigned int msb(uint64_t v)
+    {
+        return 63 - __builtin_clzll(v);
+    }
+
+    static size_t index_of(uint64_t v)
+    {
+        if (v < SUB_BUCKET_COUNT)
+            return (size_t) v;
+
+        unsigned int shift = msb(v) - (SubBucketBits - 1);
+        return (size_t) (SUB_BUCKET_COUNT + (shift - 1) * HALF_COUNT + ((v >> shift) - HALF_COUNT));
+    }
+
+    static uint64_t highest_of(size_t index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+            return index;
+
+        uint64_t shift = (index - SUB_BUCKET_COUNT) / HALF_COUNT + 1;
+        uint64_t sub_bucket = (index - SUB_BUCKET_COUNT) % HALF_COUNT + HALF_COUNT;
+        return ((sub_bucket + 1) << shift) - 1;
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_;
+    uint64_t negative_;
+    uint64_t max_;
+};
+
+#endif  // LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,99 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef PACING_HPP
+#define PACING_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace pacing {
+
+    // Paces a loop to a target rate in samples per second.
+    //
+    // Deadlines are computed from the start time against a monotonic clock
+    // (start + n * period) rather than by sleeping one period after the
+    // previous write, so the time spent writing does not accumulate as drift.
+    // The OS sleep is only used for the coarse part of the wait; the last
+    // spin_threshold before the deadline is busy-waited, which is what makes
+    // sub-millisecond periods achievable. A rate of 0 disables pacing.
+    class Pacer {
+      public:
+        typedef std::chrono::steady_clock clock;
+
+        explicit Pacer(
+            double rate,
+            std::chrono::nanoseconds spin_threshold = std::chrono::microseconds(200),
+            uint64_t max_burst = 1000)
+            : rate_(rate),
+            period_(rate > 0 ? std::chrono::nanoseconds((int64_t)(1e9 / rate)) : std::chrono::nanoseconds(0)),
+            spin_threshold_(spin_threshold),
+            max_burst_(max_burst),
+            start_(clock::now()),
+            epoch_(start_),
+            epoch_count_(0),
+            count_(0) {}
+
+        // Blocks until the next sample is due. Returns immediately in
+        // unthrottled mode.
+        void wait()
+        {
+            ++count_;
+            if (period_.count() == 0)
+                return;
+
+            clock::time_point deadline = epoch_ + period_ * (int64_t)(count_ - epoch_count_);
+            clock::time_point now = clock::now();
+
+            // If we fell behind by more than max_burst periods (e.g. the
+            // process was descheduled) restart the schedule from now instead
+            // of trying to catch up with an unbounded burst.
+            if (now - deadline > period_ * (int64_t)max_burst_) {
+                epoch_ = now;
+                epoch_count_ = count_;
+                return;
+            }
+
+            if (deadline - now > spin_threshold_)
+                std::this_thread::sleep_for(deadline - now - spin_threshold_);
+
+            while (clock::now() < deadline) {
+                // spin
+            }
+        }
+
+        double requested_rate() const { return rate_; }
+
+        // Samples per second since the pacer was created
+        double achieved_rate() const
+        {
+            std::chrono::duration<double> elapsed = clock::now() - start_;
+            return elapsed.count() > 0 ? count_ / elapsed.count() : 0.0;
+        }
+
+        uint64_t count() const { return count_; }
+
+      private:
+        double rate_;
+        std::chrono::nanoseconds period_;
+        std::chrono::nanoseconds spin_threshold_;
+        uint64_t max_burst_;
+        clock::time_point start_;
+        clock::time_point epoch_;
+        uint64_t epoch_count_;
+        uint64_t count_;
+    };
+
+}  // namespace pacing
+
+#endif  // PACING_HPP
@@ -0,0 +1,77 @@
+#!/bin/sh
+#
+# (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+# RTI grants Licensee a license to use, modify, compile, and create derivative
+# works of the software solely for use with RTI Connext DDS. Licensee may
+# redistribute copies of the software provided that all such copies are subject
+# to this license. The software is provided "as is", with no warranty of any
+# type, including any warranty for fitness for any purpose. RTI is under no
+# obligation to maintain or support the software. RTI shall not be liable for
+# any incidental or consequential damages arising out of the use or inability
+# to use the software.
+#
+# Shows the traffic a content filter saves: runs shapes_throughput with a
+# subscriber reading everything, then with subscribers filtering on some
+# keys and on a region. Each run prints the final lines of both sides. The
+# pub side's traffic line shows the bytes sent and the bytes its DataWriter
+# filtered out instead of sending.
+#
+# Usage: run_filter_benchmark.sh [samples_per_run] [domain_id]
+# INSTANCES, PROFILE, RATE and ARCH can be overridden from the environment.
+# Writer-side filtering is not done for batching DataWriters, so the profile
+# must not batch: the default throughput_reliable turns batching off, and
+# profiles that batch are refused.
+
+SAMPLES=${1:-1000000}
+DOMAIN=${2:-0}
+ARCH=${ARCH:-x64Linux4gcc7.3.0}
+INSTANCES=${INSTANCES:-64}
+PROFILE=${PROFILE:-throughput_reliable}
+RATE=${RATE:-0}
+BENCH=objs/$ARCH/shapes_throughput
+
+if [ ! -x "$BENCH" ]; then
+    echo "$BENCH not found, build with make -f makefile_shapes_$ARCH" >&2
+    exit 1
+fi
+
+# Whether a shapes_Library profile of USER_QOS_PROFILES.xml batches: its own
+# batch setting if it has one, otherwise that of its base profile. Of the
+# builtin profiles, the HighThroughput ones batch.
+batching() {
+    block=$(sed -n "/<qos_profile name=\"$1\"/,/<\/qos_profile>/p" USER_QOS_PROFILES.xml | tr -d ' \t\n')
+    case "$block" in
+        *"<batch><enable>true</enable>"*) return 0 ;;
+        *"<batch><enable>false</enable>"*) return 1 ;;
+    esac
+    base=$(echo "$block" | sed -n 's/^<qos_profilename="[^"]*"base_name="\([^"]*\)".*/\1/p')
+    case "$base" in
+        shapes_Library::*) batching "${base#shapes_Library::}" ;;
+        *HighThroughput*) return 0 ;;
+        *) return 1 ;;
+    esac
+}
+
+if batching "$PROFILE"; then
+    echo "$PROFILE batches, which turns off writer-side filtering; use a profile without batching" >&2
+    exit 1
+fi
+
+# The pub side writes x = sample number, its instances are BLUE, RED, ...,
+# BLUE_1, RED_1, ... so 'BLUE*' selects one in eight of them
+run() {
+    echo "== filter: ${1:-none}, $INSTANCES instances, $SAMPLES samples"
+    log=$(mktemp)
+    "$BENCH" --role sub -d "$DOMAIN" -q "shapes_Library::$PROFILE" ${1:+--filter "$1"} > "$log" &
+    sub=$!
+    "$BENCH" --role pub -d "$DOMAIN" -q "shapes_Library::$PROFILE" \
+        -i "$INSTANCES" -s "$SAMPLES" -r "$RATE" | grep "total"
+    # The subscriber stops once the publisher has unmatched
+    wait $sub
+    grep "total" "$log"
+    rm -f "$log"
+}
+
+run ""
+run "color MATCH 'BLUE*'"
+run "x < $((SAMPLES / 10))"
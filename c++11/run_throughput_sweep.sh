@@ -0,0 +1,61 @@
+#!/bin/sh
+#
+# (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+# RTI grants Licensee a license to use, modify, compile, and create derivative
+# works of the software solely for use with RTI Connext DDS. Licensee may
+# redistribute copies of the software provided that all such copies are subject
+# to this license. The software is provided "as is", with no warranty of any
+# type, including any warranty for fitness for any purpose. RTI is under no
+# obligation to maintain or support the software. RTI shall not be liable for
+# any incidental or consequential damages arising out of the use or inability
+# to use the software.
+#
+# Runs shapes_throughput over a range of instance counts, QoS profiles,
+# write modes (by key, or by cached instance handle), data types and data
+# representations (XCDR1 and XCDR2) on this host and prints the final line of
+# both sides for each run.
+#
+# Usage: run_throughput_sweep.sh [samples_per_run] [domain_id]
+# INSTANCES, PROFILES, WRITE_MODES, DATA_TYPES, REPRESENTATIONS and ARCH can
+# be overridden from the environment, e.g. DATA_TYPES="extended zero_copy
+# flat_data" REPRESENTATIONS=xcdr2 to compare the bindings (FlatData needs
+# XCDR2).
+
+SAMPLES=${1:-1000000}
+DOMAIN=${2:-0}
+ARCH=${ARCH:-x64Linux4gcc7.3.0}
+INSTANCES=${INSTANCES:-"1 8 1000 100000"}
+PROFILES=${PROFILES:-"throughput_reliable throughput_best_effort throughput_batching"}
+WRITE_MODES=${WRITE_MODES:-"key handle"}
+DATA_TYPES=${DATA_TYPES:-"extended"}
+REPRESENTATIONS=${REPRESENTATIONS:-"xcdr xcdr2"}
+BENCH=objs/$ARCH/shapes_throughput
+
+if [ ! -x "$BENCH" ]; then
+    echo "$BENCH not found, build with make -f makefile_shapes_$ARCH" >&2
+    exit 1
+fi
+
+for data_type in $DATA_TYPES; do
+    for representation in $REPRESENTATIONS; do
+        for profile in $PROFILES; do
+            for instances in $INSTANCES; do
+                for mode in $WRITE_MODES; do
+                    echo "== $data_type, $representation, $profile, $instances instances, by $mode, $SAMPLES samples"
+                    common="--data-type $data_type --data-representation $representation"
+                    flags="$common"
+                    [ "$mode" = "handle" ] && flags="$flags --write-with-handle"
+                    log=$(mktemp)
+                    "$BENCH" --role sub -d "$DOMAIN" -q "shapes_Library::$profile" $common > "$log" &
+                    sub=$!
+                    "$BENCH" --role pub -d "$DOMAIN" -q "shapes_Library::$profile" \
+                        -i "$instances" -s "$SAMPLES" $flags | grep "total"
+                    # The subscriber stops once the publisher has unmatched
+                    wait $sub
+                    grep "total" "$log"
+                    rm -f "$log"
+                done
+            done
+        done
+    done
+done
@@ -0,0 +1,120 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef SAMPLE_POOL_HPP
+#define SAMPLE_POOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <rti/topic/TopicTraits.hpp>
+
+// Process-wide pools of sample objects, one per type, shared by the type
+// plugin (create_data / destroy_data in shapesPlugin.cxx) and the
+// applications.
+//
+// A released sample goes back to a free list instead of the heap and is
+// handed out again as is, so its colour string keeps the capacity it grew
+// to: once the pool holds as many samples as are ever in use at once, taking
+// and returning samples, and copying keys into them, no longer allocates.
+// The counters tell how many samples ever came from the heap against how
+// many acquisitions were served from the free list.
+namespace sample_pool {
+
+    template <typename T>
+    class Pool {
+      public:
+        // Never destroyed: the middleware may still hand samples back while
+        // the process exits
+        static Pool& instance()
+        {
+            static Pool *pool = new Pool();
+            return *pool;
+        }
+
+        // A default-valued sample with the bounded members preallocated
+        T *acquire()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!free_.empty()) {
+                    T *sample = free_.back();
+                    free_.pop_back();
+                    reused_.fetch_add(1, std::memory_order_relaxed);
+
+                    // Copy-assigned, not moved, so the strings keep their
+                    // buffers
+                    *sample = blank();
+                    return sample;
+                }
+            }
+
+            T *sample = new T();
+            ::rti::topic::allocate_sample(*sample);
+            allocated_.fetch_add(1, std::memory_order_relaxed);
+            return sample;
+        }
+
+        void release(T *sample)
+        {
+            if (sample == NULL)
+                return;
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.push_back(sample);
+        }
+
+        uint64_t allocated() const { return allocated_.load(std::memory_order_relaxed); }
+        uint64_t reused() const { return reused_.load(std::memory_order_relaxed); }
+
+        size_t free_count()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return free_.size();
+        }
+
+      private:
+        Pool() : allocated_(0), reused_(0) {}
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+
+        static const T& blank()
+        {
+            static const T value;
+            return value;
+        }
+
+        std::mutex mutex_;
+        std::vector<T *> free_;
+        std::atomic<uint64_t> allocated_;
+        std::atomic<uint64_t> reused_;
+    };
+
+    // Owning pointer that gives the sample back to its pool
+    template <typename T>
+    struct Releaser {
+        void operator()(T *sample) const { Pool<T>::instance().release(sample); }
+    };
+
+    template <typename T>
+    using Pooled = std::unique_ptr<T, Releaser<T>>;
+
+    template <typename T>
+    Pooled<T> acquire()
+    {
+        return Pooled<T>(Pool<T>::instance().acquire());
+    }
+
+}  // namespace sample_pool
+
+#endif  // SAMPLE_POOL_HPP
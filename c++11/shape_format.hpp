@@ -0,0 +1,174 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef SHAPE_FORMAT_HPP
+#define SHAPE_FORMAT_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "shapes.hpp"
+
+// Allocation-free text formatting of the shapes types.
+//
+// Produces the same layout as the generated operator<< but writes into a
+// caller-owned buffer with hand-rolled number conversion (the build is C++14,
+// so std::to_chars is not available) instead of going through a stringstream.
+// Output is always NUL-terminated and truncated if the buffer is too small.
+//
+// Floats (the angle) are the one difference: operator<< prints them with 9
+// significant digits, this rounds them to 3 decimals, which is all the
+// subscriber's screen needs. 12.5 reads the same either way, 0.1f is "0.1"
+// here and "0.100000001" from operator<<.
+namespace shape_format {
+
+    // Enough for any ShapeTypeExtended with a 128 character key
+    const size_t MAX_LENGTH = 256;
+
+    class Writer {
+      public:
+        // size includes the terminating NUL and must be at least 1
+        Writer(char *buffer, size_t size)
+            : begin_(buffer), pos_(buffer), end_(buffer + size - 1) {}
+
+        void append(const char *str, size_t length)
+        {
+            size_t room = end_ - pos_;
+            if (length > room)
+                length = room;
+            memcpy(pos_, str, length);
+            pos_ += length;
+        }
+
+        void append(const char *str) { append(str, strlen(str)); }
+
+        void append(int32_t value)
+        {
+            char digits[12];
+            char *p = digits + sizeof(digits);
+            uint32_t magnitude = value < 0 ? 0u - (uint32_t) value : (uint32_t) value;
+            do {
+                *--p = (char) ('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (value < 0)
+                *--p = '-';
+            append(p, digits + sizeof(digits) - p);
+        }
+
+        // Up to three decimals, trailing zeros removed, unlike the 9
+        // significant digits of operator<<. Values that do not fit in an
+        // int32 fall back to printf.
+        void append(float value)
+        {
+            if (!std::isfinite(value) || std::fabs(value) >= 2147483.0f) {
+                char fallback[32];
+                int length = snprintf(fallback, sizeof(fallback), "%.9g", value);
+                append(fallback, length > 0 ? (size_t) length : 0);
+                return;
+            }
+
+            int32_t thousandths = (int32_t) std::lround(value * 1000.0f);
+            if (thousandths < 0) {
+                append("-", 1);
+                thousandths = -thousandths;
+            }
+            append(thousandths / 1000);
+
+            int32_t fraction = thousandths % 1000;
+            if (fraction != 0) {
+                char decimals[4] = {
+                    '.',
+                    (char) ('0' + fraction / 100),
+                    (char) ('0' + fraction / 10 % 10),
+                    (char) ('0' + fraction % 10)
+                };
+                size_t length = 4;
+                while (decimals[length - 1] == '0')
+                    --length;
+                append(decimals, length);
+            }
+        }
+
+        // Terminates the string, returns its length
+        size_t finish()
+        {
+            *pos_ = '\0';
+            return pos_ - begin_;
+        }
+
+      private:
+        char *begin_;
+        char *pos_;
+        char *end_;
+    };
+
+    inline const char *to_str(ShapeFillKind kind)
+    {
+        switch (kind) {
+            case ShapeFillKind::SOLID_FILL:
+            return "ShapeFillKind::SOLID_FILL";
+            case ShapeFillKind::TRANSPARENT_FILL:
+            return "ShapeFillKind::TRANSPARENT_FILL";
+            case ShapeFillKind::HORIZONTAL_HATCH_FILL:
+            return "ShapeFillKind::HORIZONTAL_HATCH_FILL";
+            case ShapeFillKind::VERTICAL_HATCH_FILL:
+            return "ShapeFillKind::VERTICAL_HATCH_FILL";
+            default:
+            return "";
+        }
+    }
+
+    inline void write(Writer& out, const ShapeType& shape)
+    {
+        out.append("[color: ");
+        out.append(shape.color().data(), shape.color().size());
+        out.append(", x: ");
+        out.append(shape.x());
+        out.append(", y: ");
+        out.append(shape.y());
+        out.append(", shapesize: ");
+        out.append(shape.shapesize());
+        out.append("]");
+    }
+
+    inline void write(Writer& out, const ShapeTypeExtended& shape)
+    {
+        out.append("[");
+        write(out, static_cast<const ShapeType&>(shape));
+        out.append("fillKind: ");
+        out.append(to_str(shape.fillKind()));
+        out.append(" , angle: ");
+        out.append(shape.angle());
+        out.append("]");
+    }
+
+    // Formats shape into buffer, returns the length written
+    inline size_t format(char *buffer, size_t size, const ShapeType& shape)
+    {
+        Writer out(buffer, size);
+        write(out, shape);
+        return out.finish();
+    }
+
+    inline size_t format(char *buffer, size_t size, const ShapeTypeExtended& shape)
+    {
+        Writer out(buffer, size);
+        write(out, shape);
+        return out.finish();
+    }
+
+}  // namespace shape_format
+
+#endif  // SHAPE_FORMAT_HPP
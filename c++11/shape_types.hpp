@@ -0,0 +1,140 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef SHAPE_TYPES_HPP
+#define SHAPE_TYPES_HPP
+
+#include <cstring>
+#include <string>
+
+#include "shapes.hpp"
+#include "application.hpp"  // for colours::instance_id
+#include "shapes_zero_copy.hpp"
+#include "shapes_flat_data.hpp"
+#include "shapes_compact_key.hpp"
+
+// Glue for the data types the publisher and subscriber can use (--data-type).
+// ShapeTypeExtended on "Square" is the type other Shapes applications
+// understand; the variants do not match it, so each has a topic of its own.
+// The subscriber keeps ShapeTypeExtended for its table, so every variant can
+// be turned into one.
+namespace shape_types {
+
+    template <typename T>
+    struct Traits;
+
+    template <>
+    struct Traits< ::ShapeTypeExtended> {
+        static const char *topic_name() { return "Square"; }
+    };
+
+    template <>
+    struct Traits< ::ShapeTypeZeroCopy> {
+        static const char *topic_name() { return "SquareZeroCopy"; }
+    };
+
+    template <>
+    struct Traits< ::ShapeTypeExtendedFlat> {
+        static const char *topic_name() { return "SquareFlatData"; }
+    };
+
+    template <>
+    struct Traits< ::ShapeTypeCompactKey> {
+        static const char *topic_name() { return "SquareCompactKey"; }
+    };
+
+    inline const char *key(const ::ShapeTypeExtended& shape)
+    {
+        return shape.color().c_str();
+    }
+
+    inline const char *key(const ::ShapeTypeZeroCopy& shape)
+    {
+        return shape.color().data();
+    }
+
+    inline const char *key(const ::ShapeTypeExtendedFlat& shape)
+    {
+        return shape.root().color().get_string();
+    }
+
+    // The colour names the instance in logs and on screen, the id is the key
+    inline const char *key(const ::ShapeTypeCompactKey& shape)
+    {
+        return shape.color().c_str();
+    }
+
+    inline void set_key(::ShapeTypeExtended& shape, const std::string& key)
+    {
+        shape.color(key);
+    }
+
+    // The id comes from the key alone, so publishers in different processes
+    // agree on which instance a key is
+    inline void set_key(::ShapeTypeCompactKey& shape, const std::string& key)
+    {
+        shape.id(colours::instance_id(key));
+        shape.color(key);
+    }
+
+    // The whole array is part of the key hash, so the unused tail is zeroed
+    // rather than left as whatever the loaned sample held before
+    inline void set_key(::ShapeTypeZeroCopy& shape, const std::string& key)
+    {
+        strncpy(shape.color().data(), key.c_str(), shape.color().size() - 1);
+        shape.color()[shape.color().size() - 1] = '\0';
+    }
+
+    inline const ::ShapeTypeExtended& to_extended(const ::ShapeTypeExtended& shape, ::ShapeTypeExtended&)
+    {
+        return shape;
+    }
+
+    // Fills scratch, whose colour string keeps its capacity between calls
+    inline const ::ShapeTypeExtended& to_extended(const ::ShapeTypeZeroCopy& shape, ::ShapeTypeExtended& scratch)
+    {
+        scratch.color().assign(shape.color().data());
+        scratch.x(shape.x());
+        scratch.y(shape.y());
+        scratch.shapesize(shape.shapesize());
+        scratch.fillKind(shape.fillKind());
+        scratch.angle(shape.angle());
+        return scratch;
+    }
+
+    inline const ::ShapeTypeExtended& to_extended(const ::ShapeTypeCompactKey& shape, ::ShapeTypeExtended& scratch)
+    {
+        scratch.color().assign(shape.color());
+        scratch.x(shape.x());
+        scratch.y(shape.y());
+        scratch.shapesize(shape.shapesize());
+        scratch.fillKind(shape.fillKind());
+        scratch.angle(shape.angle());
+        return scratch;
+    }
+
+    // Reads the fields in place from the serialized sample
+    inline const ::ShapeTypeExtended& to_extended(const ::ShapeTypeExtendedFlat& shape, ::ShapeTypeExtended& scratch)
+    {
+        ::ShapeTypeExtendedFlat::ConstOffset root = shape.root();
+        scratch.color().assign(root.color().get_string());
+        scratch.x(root.x());
+        scratch.y(root.y());
+        scratch.shapesize(root.shapesize());
+        scratch.fillKind(root.fillKind());
+        scratch.angle(root.angle());
+        return scratch;
+    }
+
+}  // namespace shape_types
+
+#endif  // SHAPE_TYPES_HPP
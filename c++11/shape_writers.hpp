@@ -0,0 +1,259 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef SHAPE_WRITERS_HPP
+#define SHAPE_WRITERS_HPP
+
+#include <string>
+#include <vector>
+#include <dds/pub/ddspub.hpp>
+
+#include "shape_types.hpp"
+
+// One DataWriter per --data-type, all with the same interface so the
+// publisher and shapes_throughput can be written once for every type:
+//
+//    ShapeWriter writer(participant, publisher, qos, keys, shape_size, with_handle);
+//    writer.write(index, x, y);   // update of the instance keys[index]
+//    writer.flush();              // sends what batching has queued
+//    writer.dispose_all();
+//
+// With with_handle every instance is registered up front and written through
+// its InstanceHandle, kept next to its sample, otherwise the middleware finds
+// the instance from the key of every sample: it serializes the key and hashes
+// it (an MD5 for keys too long to be the key hash verbatim) on every write.
+namespace shape_writers {
+
+    // Samples owned by the application (ShapeTypeExtended or
+    // ShapeTypeCompactKey). Each instance keeps its sample, so an update only
+    // changes the position before the middleware serializes it.
+    template <typename T>
+    class SampleWriter {
+      public:
+        SampleWriter(
+            dds::domain::DomainParticipant& participant,
+            dds::pub::Publisher& publisher,
+            const dds::pub::qos::DataWriterQos& qos,
+            const std::vector<std::string>& keys,
+            int shape_size,
+            bool with_handle)
+            : writer_(
+                publisher,
+                dds::topic::Topic<T>(participant, shape_types::Traits<T>::topic_name()),
+                qos),
+            samples_(keys.size()),
+            handles_(keys.size(), dds::core::InstanceHandle::nil())
+        {
+            for (size_t i = 0; i < keys.size(); ++i) {
+                shape_types::set_key(samples_[i], keys[i]);
+                samples_[i].shapesize(shape_size);
+                samples_[i].fillKind(ShapeFillKind::SOLID_FILL);
+
+                // Tell Connext that we will be modifying a particular
+                // instance. The key has to be set first so the right instance
+                // gets registered.
+                if (with_handle)
+                    handles_[i] = writer_.register_instance(samples_[i]);
+            }
+        }
+
+        void write(size_t index, int x, int y)
+        {
+            T& sample = samples_[index];
+            sample.x(x);
+            sample.y(y);
+            writer_.write(sample, handles_[index]);
+        }
+
+        void flush() { writer_->flush(); }
+        dds::pub::DataWriter<T>& data_writer() { return writer_; }
+
+        void dispose_all()
+        {
+            for (size_t i = 0; i < samples_.size(); ++i) {
+                dds::core::InstanceHandle handle = handles_[i];
+                if (handle.is_nil())
+                    handle = writer_.lookup_instance(samples_[i]);
+                if (!handle.is_nil())
+                    writer_.dispose_instance(handle);
+            }
+        }
+
+      private:
+        dds::pub::DataWriter<T> writer_;
+        std::vector<T> samples_;
+        std::vector<dds::core::InstanceHandle> handles_;
+    };
+
+    // ShapeTypeZeroCopy samples loaned from the DataWriter. Each update is
+    // built in a fresh shared-memory sample and only a reference to it is
+    // sent to DataReaders on this host; the middleware owns the sample once
+    // written.
+    class LoanedSampleWriter {
+      public:
+        LoanedSampleWriter(
+            dds::domain::DomainParticipant& participant,
+            dds::pub::Publisher& publisher,
+            const dds::pub::qos::DataWriterQos& qos,
+            const std::vector<std::string>& keys,
+            int shape_size,
+            bool with_handle)
+            : writer_(
+                publisher,
+                dds::topic::Topic< ::ShapeTypeZeroCopy>(participant, shape_types::Traits< ::ShapeTypeZeroCopy>::topic_name()),
+                qos),
+            keys_(keys),
+            shape_size_(shape_size),
+            handles_(keys.size(), dds::core::InstanceHandle::nil())
+        {
+            if (!with_handle)
+                return;
+
+            ::ShapeTypeZeroCopy key_holder;
+            for (size_t i = 0; i < keys_.size(); ++i) {
+                shape_types::set_key(key_holder, keys_[i]);
+                handles_[i] = writer_.register_instance(key_holder);
+            }
+        }
+
+        void write(size_t index, int x, int y)
+        {
+            ::ShapeTypeZeroCopy *sample = writer_->get_loan();
+            try {
+                shape_types::set_key(*sample, keys_[index]);
+                sample->x(x);
+                sample->y(y);
+                sample->shapesize(shape_size_);
+                sample->fillKind(ShapeFillKind::SOLID_FILL);
+                sample->angle(0.0f);
+                writer_.write(*sample, handles_[index]);
+            } catch (...) {
+                // A sample that was not written is still ours to give back
+                writer_->discard_loan(*sample);
+                throw;
+            }
+        }
+
+        void flush() { writer_->flush(); }
+        dds::pub::DataWriter< ::ShapeTypeZeroCopy>& data_writer() { return writer_; }
+
+        void dispose_all()
+        {
+            ::ShapeTypeZeroCopy key_holder;
+            for (size_t i = 0; i < keys_.size(); ++i) {
+                dds::core::InstanceHandle handle = handles_[i];
+                if (handle.is_nil()) {
+                    shape_types::set_key(key_holder, keys_[i]);
+                    handle = writer_.lookup_instance(key_holder);
+                }
+                if (!handle.is_nil())
+                    writer_.dispose_instance(handle);
+            }
+        }
+
+      private:
+        dds::pub::DataWriter< ::ShapeTypeZeroCopy> writer_;
+        std::vector<std::string> keys_;
+        int shape_size_;
+        std::vector<dds::core::InstanceHandle> handles_;
+    };
+
+    // ShapeTypeExtendedFlat samples built in place, in their serialized form,
+    // in buffers loaned from the DataWriter. Nothing is copied into or out of
+    // a C++ object on the way to the wire.
+    class FlatSampleWriter {
+      public:
+        FlatSampleWriter(
+            dds::domain::DomainParticipant& participant,
+            dds::pub::Publisher& publisher,
+            const dds::pub::qos::DataWriterQos& qos,
+            const std::vector<std::string>& keys,
+            int shape_size,
+            bool with_handle)
+            : writer_(
+                publisher,
+                dds::topic::Topic< ::ShapeTypeExtendedFlat>(participant, shape_types::Traits< ::ShapeTypeExtendedFlat>::topic_name()),
+                qos),
+            keys_(keys),
+            shape_size_(shape_size),
+            handles_(keys.size(), dds::core::InstanceHandle::nil())
+        {
+            if (!with_handle)
+                return;
+
+            // FlatData samples only exist in loaned buffers, so registration
+            // builds a sample holding just the key and gives it back
+            for (size_t i = 0; i < keys_.size(); ++i) {
+                ::ShapeTypeExtendedFlat *key_holder = build(i, 0, 0);
+                handles_[i] = writer_.register_instance(*key_holder);
+                writer_->discard_loan(*key_holder);
+            }
+        }
+
+        void write(size_t index, int x, int y)
+        {
+            ::ShapeTypeExtendedFlat *sample = build(index, x, y);
+            try {
+                writer_.write(*sample, handles_[index]);
+            } catch (...) {
+                writer_->discard_loan(*sample);
+                throw;
+            }
+        }
+
+        void flush() { writer_->flush(); }
+        dds::pub::DataWriter< ::ShapeTypeExtendedFlat>& data_writer() { return writer_; }
+
+        void dispose_all()
+        {
+            for (size_t i = 0; i < keys_.size(); ++i) {
+                dds::core::InstanceHandle handle = handles_[i];
+                if (handle.is_nil()) {
+                    ::ShapeTypeExtendedFlat *key_holder = build(i, 0, 0);
+                    handle = writer_.lookup_instance(*key_holder);
+                    writer_->discard_loan(*key_holder);
+                }
+                if (!handle.is_nil())
+                    writer_.dispose_instance(handle);
+            }
+        }
+
+      private:
+        ::ShapeTypeExtendedFlat *build(size_t index, int x, int y)
+        {
+            auto builder = rti::flat::build_data(writer_);
+            try {
+                auto color_builder = builder.build_color();
+                color_builder.set_string(keys_[index].c_str());
+                color_builder.finish();
+
+                builder.add_x(x);
+                builder.add_y(y);
+                builder.add_shapesize(shape_size_);
+                builder.add_fillKind(ShapeFillKind::SOLID_FILL);
+                builder.add_angle(0.0f);
+            } catch (...) {
+                rti::flat::discard_builder(writer_, builder);
+                throw;
+            }
+            return builder.finish_sample();
+        }
+
+        dds::pub::DataWriter< ::ShapeTypeExtendedFlat> writer_;
+        std::vector<std::string> keys_;
+        int shape_size_;
+        std::vector<dds::core::InstanceHandle> handles_;
+    };
+
+}  // namespace shape_writers
+
+#endif  // SHAPE_WRITERS_HPP
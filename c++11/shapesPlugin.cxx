@@ -62,6 +62,7 @@ or consult the Code Generator User's Manual.
 #define RTI_CDR_CURRENT_SUBMODULE RTI_CDR_SUBMODULE_MASK_STREAM
 
 #include "shapesPlugin.hpp"
+#include "sample_pool.hpp"
 
 /* ----------------------------------------------------------------------------
 (De)Serialize functions:
@@ -128,13 +129,14 @@ void ShapeFillKindPluginSupport_print_data(
 Support functions:
 * -------------------------------------------------------------------------- */
 
+/* Samples come from and return to sample_pool::Pool<ShapeType> rather than
+   the heap; keep these hooks when regenerating this file. copy_data assigns
+   into an existing sample, which reuses the destination's string buffer. */
 ShapeType *
 ShapeTypePluginSupport_create_data(void)
 {
     try {
-        ShapeType *sample = new ShapeType();
-        ::rti::topic::allocate_sample(*sample);
-        return sample;
+        return ::sample_pool::Pool< ShapeType >::instance().acquire();
     } catch (...) {
         return NULL;
     }
@@ -144,7 +146,7 @@ void
 ShapeTypePluginSupport_destroy_data(
     ShapeType *sample) 
 {
-    delete sample;
+    ::sample_pool::Pool< ShapeType >::instance().release(sample);
 }
 
 RTIBool 
@@ -807,13 +809,14 @@ ShapeTypePlugin_delete(struct PRESTypePlugin *plugin)
 Support functions:
 * -------------------------------------------------------------------------- */
 
+/* Samples come from and return to sample_pool::Pool<ShapeTypeExtended> rather than
+   the heap; keep these hooks when regenerating this file. copy_data assigns
+   into an existing sample, which reuses the destination's string buffer. */
 ShapeTypeExtended *
 ShapeTypeExtendedPluginSupport_create_data(void)
 {
     try {
-        ShapeTypeExtended *sample = new ShapeTypeExtended();
-        ::rti::topic::allocate_sample(*sample);
-        return sample;
+        return ::sample_pool::Pool< ShapeTypeExtended >::instance().acquire();
     } catch (...) {
         return NULL;
     }
@@ -823,7 +826,7 @@ void
 ShapeTypeExtendedPluginSupport_destroy_data(
     ShapeTypeExtended *sample) 
 {
-    delete sample;
+    ::sample_pool::Pool< ShapeTypeExtended >::instance().release(sample);
 }
 
 RTIBool 
@@ -0,0 +1,515 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_compact_key.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_compact_key.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#include <iosfwd>
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#ifndef NDDS_STANDALONE_TYPE
+#include "rti/topic/cdr/Serialization.hpp"
+#include "shapes_compact_keyPlugin.hpp"
+#else
+#include "rti/topic/cdr/SerializationHelpers.hpp"
+#endif
+
+#include "shapes_compact_key.hpp"
+
+#include <rti/util/ostream_operators.hpp>
+
+// ---- ShapeTypeCompactKey:
+
+ShapeTypeCompactKey::ShapeTypeCompactKey() :
+    m_id_ (0u) ,
+    m_color_ ("") ,
+    m_x_ (0) ,
+    m_y_ (0) ,
+    m_shapesize_ (0) ,
+    m_fillKind_(ShapeFillKind::SOLID_FILL) ,
+    m_angle_ (0.0f)  {
+
+}
+
+ShapeTypeCompactKey::ShapeTypeCompactKey (uint32_t id_,const std::string& color_,int32_t x_,int32_t y_,int32_t shapesize_,const ::ShapeFillKind& fillKind_,float angle_):
+    m_id_(id_),
+    m_color_(color_),
+    m_x_(x_),
+    m_y_(y_),
+    m_shapesize_(shapesize_),
+    m_fillKind_(fillKind_),
+    m_angle_(angle_) {
+}
+
+void ShapeTypeCompactKey::swap(ShapeTypeCompactKey& other_)  noexcept
+{
+    using std::swap;
+    swap(m_id_, other_.m_id_);
+    swap(m_color_, other_.m_color_);
+    swap(m_x_, other_.m_x_);
+    swap(m_y_, other_.m_y_);
+    swap(m_shapesize_, other_.m_shapesize_);
+    swap(m_fillKind_, other_.m_fillKind_);
+    swap(m_angle_, other_.m_angle_);
+}
+
+bool ShapeTypeCompactKey::operator == (const ShapeTypeCompactKey& other_) const {
+    if (m_id_ != other_.m_id_) {
+        return false;
+    }
+    if (m_color_ != other_.m_color_) {
+        return false;
+    }
+    if (m_x_ != other_.m_x_) {
+        return false;
+    }
+    if (m_y_ != other_.m_y_) {
+        return false;
+    }
+    if (m_shapesize_ != other_.m_shapesize_) {
+        return false;
+    }
+    if (m_fillKind_ != other_.m_fillKind_) {
+        return false;
+    }
+    if (std::fabs(m_angle_ - other_.m_angle_) > std::numeric_limits< float>::epsilon()
+    && !(std::fabs(m_angle_ - other_.m_angle_) < (std::numeric_limits< float>::min)())) {
+        return false;
+    }
+    return true;
+}
+
+bool ShapeTypeCompactKey::operator != (const ShapeTypeCompactKey& other_) const {
+    return !this->operator ==(other_);
+}
+
+std::ostream& operator << (std::ostream& o,const ShapeTypeCompactKey& sample)
+{
+    ::rti::util::StreamFlagSaver flag_saver (o);
+    o <<"[";
+    o << "id: " << sample.id ()<<", ";
+    o << "color: " << sample.color ()<<", ";
+    o << "x: " << sample.x ()<<", ";
+    o << "y: " << sample.y ()<<", ";
+    o << "shapesize: " << sample.shapesize ()<<", ";
+    o << "fillKind: " << sample.fillKind ()<<", ";
+    o << "angle: " << std::setprecision(9) << sample.angle ();
+    o <<"]";
+    return o;
+}
+
+#ifndef NDDS_STANDALONE_TYPE
+// --- Type traits: -------------------------------------------------
+
+namespace rti {
+    namespace topic {
+
+        template<>
+        struct native_type_code< ::ShapeTypeCompactKey > {
+            static DDS_TypeCode * get()
+            {
+                using namespace ::rti::topic::interpreter;
+
+                static RTIBool is_initialized = RTI_FALSE;
+
+                static DDS_TypeCode ShapeTypeCompactKey_g_tc_color_string;
+
+                static DDS_TypeCode_Member ShapeTypeCompactKey_g_tc_members[7]=
+                {
+
+                    {
+                        (char *)"id",/* Member name */
+                        {
+                            0,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_KEY_MEMBER , /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"color",/* Member name */
+                        {
+                            1,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"x",/* Member name */
+                        {
+                            2,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"y",/* Member name */
+                        {
+                            3,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"shapesize",/* Member name */
+                        {
+                            4,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"fillKind",/* Member name */
+                        {
+                            5,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"angle",/* Member name */
+                        {
+                            6,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    }
+                };
+
+                static DDS_TypeCode ShapeTypeCompactKey_g_tc =
+                {{
+                        DDS_TK_STRUCT, /* Kind */
+                        DDS_BOOLEAN_FALSE, /* Ignored */
+                        -1, /*Ignored*/
+                        (char *)"ShapeTypeCompactKey", /* Name */
+                        NULL, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        7, /* Number of members */
+                        ShapeTypeCompactKey_g_tc_members, /* Members */
+                        DDS_VM_NONE, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER,
+                        DDS_BOOLEAN_TRUE, /* _isCopyable */
+                        NULL, /* _sampleAccessInfo: assigned later */
+                        NULL /* _typePlugin: assigned later */
+                    }}; /* Type code for ShapeTypeCompactKey*/
+
+                if (is_initialized) {
+                    return &ShapeTypeCompactKey_g_tc;
+                }
+
+                is_initialized = RTI_TRUE;
+
+                ShapeTypeCompactKey_g_tc_color_string = initialize_string_typecode((128L));
+
+                ShapeTypeCompactKey_g_tc._data._annotations._allowedDataRepresentationMask = 5;
+
+                ShapeTypeCompactKey_g_tc_members[0]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_ulong;
+                ShapeTypeCompactKey_g_tc_members[1]._representation._typeCode = (RTICdrTypeCode *)&ShapeTypeCompactKey_g_tc_color_string;
+                ShapeTypeCompactKey_g_tc_members[2]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeCompactKey_g_tc_members[3]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeCompactKey_g_tc_members[4]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeCompactKey_g_tc_members[5]._representation._typeCode = (RTICdrTypeCode *)&::rti::topic::dynamic_type< ::ShapeFillKind>::get().native();
+                ShapeTypeCompactKey_g_tc_members[6]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_float;
+
+                /* Initialize the values for member annotations. */
+                ShapeTypeCompactKey_g_tc_members[0]._annotations._defaultValue._d = RTI_XCDR_TK_ULONG;
+                ShapeTypeCompactKey_g_tc_members[0]._annotations._defaultValue._u.ulong_value = 0u;
+                ShapeTypeCompactKey_g_tc_members[0]._annotations._minValue._d = RTI_XCDR_TK_ULONG;
+                ShapeTypeCompactKey_g_tc_members[0]._annotations._minValue._u.ulong_value = RTIXCdrUnsignedLong_MIN;
+                ShapeTypeCompactKey_g_tc_members[0]._annotations._maxValue._d = RTI_XCDR_TK_ULONG;
+                ShapeTypeCompactKey_g_tc_members[0]._annotations._maxValue._u.ulong_value = RTIXCdrUnsignedLong_MAX;
+                ShapeTypeCompactKey_g_tc_members[1]._annotations._defaultValue._d = RTI_XCDR_TK_STRING;
+                ShapeTypeCompactKey_g_tc_members[1]._annotations._defaultValue._u.string_value = (DDS_Char *) "";
+                ShapeTypeCompactKey_g_tc_members[2]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[2]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeCompactKey_g_tc_members[2]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[2]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeCompactKey_g_tc_members[2]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[2]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeCompactKey_g_tc_members[3]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[3]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeCompactKey_g_tc_members[3]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[3]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeCompactKey_g_tc_members[3]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[3]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeCompactKey_g_tc_members[4]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[4]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeCompactKey_g_tc_members[4]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[4]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeCompactKey_g_tc_members[4]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeCompactKey_g_tc_members[4]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeCompactKey_g_tc_members[5]._annotations._defaultValue._d = RTI_XCDR_TK_ENUM;
+                ShapeTypeCompactKey_g_tc_members[5]._annotations._defaultValue._u.enumerated_value = 0;
+                ShapeTypeCompactKey_g_tc_members[6]._annotations._defaultValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeCompactKey_g_tc_members[6]._annotations._defaultValue._u.float_value = 0.0f;
+                ShapeTypeCompactKey_g_tc_members[6]._annotations._minValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeCompactKey_g_tc_members[6]._annotations._minValue._u.float_value = RTIXCdrFloat_MIN;
+                ShapeTypeCompactKey_g_tc_members[6]._annotations._maxValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeCompactKey_g_tc_members[6]._annotations._maxValue._u.float_value = RTIXCdrFloat_MAX;
+
+                ShapeTypeCompactKey_g_tc._data._sampleAccessInfo = sample_access_info();
+                ShapeTypeCompactKey_g_tc._data._typePlugin = type_plugin_info();
+
+                return &ShapeTypeCompactKey_g_tc;
+            }
+
+            static RTIXCdrSampleAccessInfo * sample_access_info()
+            {
+                static RTIBool is_initialized = RTI_FALSE;
+
+                ::ShapeTypeCompactKey *sample;
+
+                static RTIXCdrMemberAccessInfo ShapeTypeCompactKey_g_memberAccessInfos[7] =
+                {RTIXCdrMemberAccessInfo_INITIALIZER};
+
+                static RTIXCdrSampleAccessInfo ShapeTypeCompactKey_g_sampleAccessInfo =
+                RTIXCdrSampleAccessInfo_INITIALIZER;
+
+                if (is_initialized) {
+                    return (RTIXCdrSampleAccessInfo*) &ShapeTypeCompactKey_g_sampleAccessInfo;
+                }
+
+                RTIXCdrHeap_allocateStruct(
+                    &sample,
+                    ::ShapeTypeCompactKey);
+                if (sample == NULL) {
+                    return NULL;
+                }
+
+                ShapeTypeCompactKey_g_memberAccessInfos[0].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->id() - (char *)sample);
+
+                ShapeTypeCompactKey_g_memberAccessInfos[1].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->color() - (char *)sample);
+
+                ShapeTypeCompactKey_g_memberAccessInfos[2].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->x() - (char *)sample);
+
+                ShapeTypeCompactKey_g_memberAccessInfos[3].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->y() - (char *)sample);
+
+                ShapeTypeCompactKey_g_memberAccessInfos[4].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->shapesize() - (char *)sample);
+
+                ShapeTypeCompactKey_g_memberAccessInfos[5].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->fillKind() - (char *)sample);
+
+                ShapeTypeCompactKey_g_memberAccessInfos[6].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->angle() - (char *)sample);
+
+                ShapeTypeCompactKey_g_sampleAccessInfo.memberAccessInfos =
+                ShapeTypeCompactKey_g_memberAccessInfos;
+
+                {
+                    size_t candidateTypeSize = sizeof(::ShapeTypeCompactKey);
+
+                    if (candidateTypeSize > RTIXCdrLong_MAX) {
+                        ShapeTypeCompactKey_g_sampleAccessInfo.typeSize[0] =
+                        RTIXCdrLong_MAX;
+                    } else {
+                        ShapeTypeCompactKey_g_sampleAccessInfo.typeSize[0] =
+                        (RTIXCdrUnsignedLong) candidateTypeSize;
+                    }
+                }
+
+                ShapeTypeCompactKey_g_sampleAccessInfo.useGetMemberValueOnlyWithRef =
+                RTI_XCDR_TRUE;
+
+                ShapeTypeCompactKey_g_sampleAccessInfo.getMemberValuePointerFcn =
+                interpreter::get_aggregation_value_pointer< ::ShapeTypeCompactKey >;
+
+                ShapeTypeCompactKey_g_sampleAccessInfo.languageBinding =
+                RTI_XCDR_TYPE_BINDING_CPP_11_STL ;
+
+                RTIXCdrHeap_freeStruct(sample);
+                is_initialized = RTI_TRUE;
+                return (RTIXCdrSampleAccessInfo*) &ShapeTypeCompactKey_g_sampleAccessInfo;
+            }
+            static RTIXCdrTypePlugin * type_plugin_info()
+            {
+                static RTIXCdrTypePlugin ShapeTypeCompactKey_g_typePlugin =
+                {
+                    NULL, /* serialize */
+                    NULL, /* serialize_key */
+                    NULL, /* deserialize_sample */
+                    NULL, /* deserialize_key_sample */
+                    NULL, /* skip */
+                    NULL, /* get_serialized_sample_size */
+                    NULL, /* get_serialized_sample_max_size_ex */
+                    NULL, /* get_serialized_key_max_size_ex */
+                    NULL, /* get_serialized_sample_min_size */
+                    NULL, /* serialized_sample_to_key */
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL
+                };
+
+                return &ShapeTypeCompactKey_g_typePlugin;
+            }
+        }; // native_type_code
+
+        const ::dds::core::xtypes::StructType& dynamic_type< ::ShapeTypeCompactKey >::get()
+        {
+            return static_cast<const ::dds::core::xtypes::StructType&>(
+                ::rti::core::native_conversions::cast_from_native< ::dds::core::xtypes::DynamicType >(
+                    *(native_type_code< ::ShapeTypeCompactKey >::get())));
+        }
+    }
+}
+
+namespace dds {
+    namespace topic {
+        void topic_type_support< ::ShapeTypeCompactKey >:: register_type(
+            ::dds::domain::DomainParticipant& participant,
+            const std::string& type_name)
+        {
+
+            ::rti::domain::register_type_plugin(
+                participant,
+                type_name,
+                ::ShapeTypeCompactKeyPlugin_new,
+                ::ShapeTypeCompactKeyPlugin_delete);
+        }
+
+        std::vector<char>& topic_type_support< ::ShapeTypeCompactKey >::to_cdr_buffer(
+            std::vector<char>& buffer,
+            const ::ShapeTypeCompactKey& sample,
+            ::dds::core::policy::DataRepresentationId representation)
+        {
+            // First get the length of the buffer
+            unsigned int length = 0;
+            RTIBool ok = ShapeTypeCompactKeyPlugin_serialize_to_cdr_buffer(
+                NULL,
+                &length,
+                &sample,
+                representation);
+            ::rti::core::check_return_code(
+                ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+                "Failed to calculate cdr buffer size");
+
+            // Create a vector with that size and copy the cdr buffer into it
+            buffer.resize(length);
+            ok = ShapeTypeCompactKeyPlugin_serialize_to_cdr_buffer(
+                &buffer[0],
+                &length,
+                &sample,
+                representation);
+            ::rti::core::check_return_code(
+                ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+                "Failed to copy cdr buffer");
+
+            return buffer;
+        }
+
+        void topic_type_support< ::ShapeTypeCompactKey >::from_cdr_buffer(::ShapeTypeCompactKey& sample,
+        const std::vector<char>& buffer)
+        {
+
+            RTIBool ok  = ShapeTypeCompactKeyPlugin_deserialize_from_cdr_buffer(
+                &sample,
+                &buffer[0],
+                static_cast<unsigned int>(buffer.size()));
+            ::rti::core::check_return_code(ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+            "Failed to create ::ShapeTypeCompactKey from cdr buffer");
+        }
+
+        void topic_type_support< ::ShapeTypeCompactKey >::reset_sample(::ShapeTypeCompactKey& sample)
+        {
+            sample.id(0u);
+            sample.color("");
+            sample.x(0);
+            sample.y(0);
+            sample.shapesize(0);
+            sample.fillKind(ShapeFillKind::SOLID_FILL);
+            sample.angle(0.0f);
+        }
+
+        void topic_type_support< ::ShapeTypeCompactKey >::allocate_sample(::ShapeTypeCompactKey& sample, int, int)
+        {
+            ::rti::topic::allocate_sample(sample.color(),  -1, 128L);
+            ::rti::topic::allocate_sample(sample.fillKind(),  -1, -1);
+        }
+    }
+}
+
+#endif // NDDS_STANDALONE_TYPE
@@ -0,0 +1,247 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_compact_key.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_compact_key.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#ifndef shapes_compact_keyPlugin_1204391876_h
+#define shapes_compact_keyPlugin_1204391876_h
+
+#include "shapes_compact_key.hpp"
+
+struct RTICdrStream;
+
+#ifndef pres_typePlugin_h
+#include "pres/pres_typePlugin.h"
+#endif
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, start exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport __declspec(dllexport)
+#endif
+
+/* The type used to store keys for instances of type struct
+* AnotherSimple.
+*
+* By default, this type is struct ShapeTypeCompactKey
+* itself. However, if for some reason this choice is not practical for your
+* system (e.g. if sizeof(struct ShapeTypeCompactKey)
+* is very large), you may redefine this typedef in terms of another type of
+* your choosing. HOWEVER, if you define the KeyHolder type to be something
+* other than struct AnotherSimple, the
+* following restriction applies: the key of struct
+* ShapeTypeCompactKey must consist of a
+* single field of your redefined KeyHolder type and that field must be the
+* first field in struct ShapeTypeCompactKey.
+*/
+typedef class ShapeTypeCompactKey ShapeTypeCompactKeyKeyHolder;
+
+#define ShapeTypeCompactKeyPlugin_get_sample PRESTypePluginDefaultEndpointData_getSample
+
+#define ShapeTypeCompactKeyPlugin_get_buffer PRESTypePluginDefaultEndpointData_getBuffer
+#define ShapeTypeCompactKeyPlugin_return_buffer PRESTypePluginDefaultEndpointData_returnBuffer
+
+#define ShapeTypeCompactKeyPlugin_get_key PRESTypePluginDefaultEndpointData_getKey
+#define ShapeTypeCompactKeyPlugin_return_key PRESTypePluginDefaultEndpointData_returnKey
+
+#define ShapeTypeCompactKeyPlugin_create_sample PRESTypePluginDefaultEndpointData_createSample
+#define ShapeTypeCompactKeyPlugin_destroy_sample PRESTypePluginDefaultEndpointData_deleteSample
+
+/* --------------------------------------------------------------------------------------
+Support functions:
+* -------------------------------------------------------------------------------------- */
+
+NDDSUSERDllExport extern ShapeTypeCompactKey*
+ShapeTypeCompactKeyPluginSupport_create_data_w_params(
+    const struct DDS_TypeAllocationParams_t * alloc_params);
+
+NDDSUSERDllExport extern ShapeTypeCompactKey*
+ShapeTypeCompactKeyPluginSupport_create_data_ex(RTIBool allocate_pointers);
+
+NDDSUSERDllExport extern ShapeTypeCompactKey*
+ShapeTypeCompactKeyPluginSupport_create_data(void);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPluginSupport_copy_data(
+    ShapeTypeCompactKey *out,
+    const ShapeTypeCompactKey *in);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPluginSupport_destroy_data_w_params(
+    ShapeTypeCompactKey *sample,
+    const struct DDS_TypeDeallocationParams_t * dealloc_params);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPluginSupport_destroy_data_ex(
+    ShapeTypeCompactKey *sample,RTIBool deallocate_pointers);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPluginSupport_destroy_data(
+    ShapeTypeCompactKey *sample);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPluginSupport_print_data(
+    const ShapeTypeCompactKey *sample,
+    const char *desc,
+    unsigned int indent);
+
+NDDSUSERDllExport extern ShapeTypeCompactKey*
+ShapeTypeCompactKeyPluginSupport_create_key_ex(RTIBool allocate_pointers);
+
+NDDSUSERDllExport extern ShapeTypeCompactKey*
+ShapeTypeCompactKeyPluginSupport_create_key(void);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPluginSupport_destroy_key_ex(
+    ShapeTypeCompactKeyKeyHolder *key,RTIBool deallocate_pointers);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPluginSupport_destroy_key(
+    ShapeTypeCompactKeyKeyHolder *key);
+
+/* ----------------------------------------------------------------------------
+Callback functions:
+* ---------------------------------------------------------------------------- */
+
+NDDSUSERDllExport extern PRESTypePluginParticipantData
+ShapeTypeCompactKeyPlugin_on_participant_attached(
+    void *registration_data,
+    const struct PRESTypePluginParticipantInfo *participant_info,
+    RTIBool top_level_registration,
+    void *container_plugin_context,
+    RTICdrTypeCode *typeCode);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPlugin_on_participant_detached(
+    PRESTypePluginParticipantData participant_data);
+
+NDDSUSERDllExport extern PRESTypePluginEndpointData
+ShapeTypeCompactKeyPlugin_on_endpoint_attached(
+    PRESTypePluginParticipantData participant_data,
+    const struct PRESTypePluginEndpointInfo *endpoint_info,
+    RTIBool top_level_registration,
+    void *container_plugin_context);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPlugin_on_endpoint_detached(
+    PRESTypePluginEndpointData endpoint_data);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPlugin_return_sample(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeCompactKey *sample,
+    void *handle);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_copy_sample(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeCompactKey *out,
+    const ShapeTypeCompactKey *in);
+
+/* ----------------------------------------------------------------------------
+(De)Serialize functions:
+* ------------------------------------------------------------------------- */
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_serialize_to_cdr_buffer(
+    char * buffer,
+    unsigned int * length,
+    const ShapeTypeCompactKey *sample,
+    ::dds::core::policy::DataRepresentationId representation
+    = ::dds::core::policy::DataRepresentation::xcdr());
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_deserialize(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeCompactKey **sample,
+    RTIBool * drop_sample,
+    struct RTICdrStream *stream,
+    RTIBool deserialize_encapsulation,
+    RTIBool deserialize_sample,
+    void *endpoint_plugin_qos);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_deserialize_from_cdr_buffer(
+    ShapeTypeCompactKey *sample,
+    const char * buffer,
+    unsigned int length);
+
+NDDSUSERDllExport extern unsigned int
+ShapeTypeCompactKeyPlugin_get_serialized_sample_max_size(
+    PRESTypePluginEndpointData endpoint_data,
+    RTIBool include_encapsulation,
+    RTIEncapsulationId encapsulation_id,
+    unsigned int current_alignment);
+
+/* --------------------------------------------------------------------------------------
+Key Management functions:
+* -------------------------------------------------------------------------------------- */
+NDDSUSERDllExport extern PRESTypePluginKeyKind
+ShapeTypeCompactKeyPlugin_get_key_kind(void);
+
+NDDSUSERDllExport extern unsigned int
+ShapeTypeCompactKeyPlugin_get_serialized_key_max_size(
+    PRESTypePluginEndpointData endpoint_data,
+    RTIBool include_encapsulation,
+    RTIEncapsulationId encapsulation_id,
+    unsigned int current_alignment);
+
+NDDSUSERDllExport extern unsigned int
+ShapeTypeCompactKeyPlugin_get_serialized_key_max_size_for_keyhash(
+    PRESTypePluginEndpointData endpoint_data,
+    RTIEncapsulationId encapsulation_id,
+    unsigned int current_alignment);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_deserialize_key(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeCompactKey ** sample,
+    RTIBool * drop_sample,
+    struct RTICdrStream *stream,
+    RTIBool deserialize_encapsulation,
+    RTIBool deserialize_key,
+    void *endpoint_plugin_qos);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_instance_to_key(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeCompactKeyKeyHolder *key,
+    const ShapeTypeCompactKey *instance);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_key_to_instance(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeCompactKey *instance,
+    const ShapeTypeCompactKeyKeyHolder *key);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeCompactKeyPlugin_serialized_sample_to_keyhash(
+    PRESTypePluginEndpointData endpoint_data,
+    struct RTICdrStream *stream,
+    DDS_KeyHash_t *keyhash,
+    RTIBool deserialize_encapsulation,
+    void *endpoint_plugin_qos);
+
+/* Plugin Functions */
+NDDSUSERDllExport extern struct PRESTypePlugin*
+ShapeTypeCompactKeyPlugin_new(void);
+
+NDDSUSERDllExport extern void
+ShapeTypeCompactKeyPlugin_delete(struct PRESTypePlugin *);
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, stop exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport
+#endif
+
+#endif /* shapes_compact_keyPlugin_1204391876_h */
+
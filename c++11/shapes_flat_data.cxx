@@ -0,0 +1,493 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_flat_data.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_flat_data.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#include <iosfwd>
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#ifndef NDDS_STANDALONE_TYPE
+#include "rti/topic/cdr/Serialization.hpp"
+#include "shapes_flat_dataPlugin.hpp"
+#else
+#include "rti/topic/cdr/SerializationHelpers.hpp"
+#endif
+
+#include "shapes_flat_data.hpp"
+
+#include <rti/util/ostream_operators.hpp>
+
+// ---- ShapeTypeExtendedFlat:
+
+const ::rti::flat::StringOffset ShapeTypeExtendedFlatConstOffset::color() const
+{
+    return Base::get_member< ::rti::flat::StringOffset >(0);
+}
+
+int32_t ShapeTypeExtendedFlatConstOffset::x() const
+{
+    return Base::deserialize< int32_t >(1);
+}
+
+int32_t ShapeTypeExtendedFlatConstOffset::y() const
+{
+    return Base::deserialize< int32_t >(2);
+}
+
+int32_t ShapeTypeExtendedFlatConstOffset::shapesize() const
+{
+    return Base::deserialize< int32_t >(3);
+}
+
+::ShapeFillKind ShapeTypeExtendedFlatConstOffset::fillKind() const
+{
+    return Base::deserialize< ::ShapeFillKind >(4);
+}
+
+float ShapeTypeExtendedFlatConstOffset::angle() const
+{
+    return Base::deserialize< float >(5);
+}
+
+const ::rti::flat::StringOffset ShapeTypeExtendedFlatOffset::color() const
+{
+    return Base::get_member< ::rti::flat::StringOffset >(0);
+}
+
+::rti::flat::StringOffset ShapeTypeExtendedFlatOffset::color()
+{
+    return Base::get_member< ::rti::flat::StringOffset >(0);
+}
+
+int32_t ShapeTypeExtendedFlatOffset::x() const
+{
+    return Base::deserialize< int32_t >(1);
+}
+
+bool ShapeTypeExtendedFlatOffset::x(int32_t value)
+{
+    return Base::serialize(1, value);
+}
+
+int32_t ShapeTypeExtendedFlatOffset::y() const
+{
+    return Base::deserialize< int32_t >(2);
+}
+
+bool ShapeTypeExtendedFlatOffset::y(int32_t value)
+{
+    return Base::serialize(2, value);
+}
+
+int32_t ShapeTypeExtendedFlatOffset::shapesize() const
+{
+    return Base::deserialize< int32_t >(3);
+}
+
+bool ShapeTypeExtendedFlatOffset::shapesize(int32_t value)
+{
+    return Base::serialize(3, value);
+}
+
+::ShapeFillKind ShapeTypeExtendedFlatOffset::fillKind() const
+{
+    return Base::deserialize< ::ShapeFillKind >(4);
+}
+
+bool ShapeTypeExtendedFlatOffset::fillKind(::ShapeFillKind value)
+{
+    return Base::serialize(4, value);
+}
+
+float ShapeTypeExtendedFlatOffset::angle() const
+{
+    return Base::deserialize< float >(5);
+}
+
+bool ShapeTypeExtendedFlatOffset::angle(float value)
+{
+    return Base::serialize(5, value);
+}
+
+::rti::flat::StringBuilder ShapeTypeExtendedFlatBuilder::build_color()
+{
+    return Base::build_member< ::rti::flat::StringBuilder >(0);
+}
+
+ShapeTypeExtendedFlatBuilder& ShapeTypeExtendedFlatBuilder::add_x(int32_t value)
+{
+    Base::add_primitive_member(1, value);
+    return *this;
+}
+
+ShapeTypeExtendedFlatBuilder& ShapeTypeExtendedFlatBuilder::add_y(int32_t value)
+{
+    Base::add_primitive_member(2, value);
+    return *this;
+}
+
+ShapeTypeExtendedFlatBuilder& ShapeTypeExtendedFlatBuilder::add_shapesize(int32_t value)
+{
+    Base::add_primitive_member(3, value);
+    return *this;
+}
+
+ShapeTypeExtendedFlatBuilder& ShapeTypeExtendedFlatBuilder::add_fillKind(::ShapeFillKind value)
+{
+    Base::add_primitive_member(4, value);
+    return *this;
+}
+
+ShapeTypeExtendedFlatBuilder& ShapeTypeExtendedFlatBuilder::add_angle(float value)
+{
+    Base::add_primitive_member(5, value);
+    return *this;
+}
+
+#ifndef NDDS_STANDALONE_TYPE
+// --- Type traits: -------------------------------------------------
+
+namespace rti {
+    namespace topic {
+
+        template<>
+        struct native_type_code< ::ShapeTypeExtendedFlat > {
+            static DDS_TypeCode * get()
+            {
+                using namespace ::rti::topic::interpreter;
+
+                static RTIBool is_initialized = RTI_FALSE;
+
+                static DDS_TypeCode ShapeTypeExtendedFlat_g_tc_color_string;
+
+                static DDS_TypeCode_Member ShapeTypeExtendedFlat_g_tc_members[6]=
+                {
+
+                    {
+                        (char *)"color",/* Member name */
+                        {
+                            0,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_KEY_MEMBER , /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"x",/* Member name */
+                        {
+                            1,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"y",/* Member name */
+                        {
+                            2,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"shapesize",/* Member name */
+                        {
+                            3,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"fillKind",/* Member name */
+                        {
+                            4,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"angle",/* Member name */
+                        {
+                            5,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    }
+                };
+
+                static DDS_TypeCode ShapeTypeExtendedFlat_g_tc =
+                {{
+                        DDS_TK_STRUCT| RTI_XCDR_TK_FLAGS_IS_MUTABLE, /* Kind */
+                        DDS_BOOLEAN_FALSE, /* Ignored */
+                        -1, /*Ignored*/
+                        (char *)"ShapeTypeExtendedFlat", /* Name */
+                        NULL, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        6, /* Number of members */
+                        ShapeTypeExtendedFlat_g_tc_members, /* Members */
+                        DDS_VM_NONE, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER,
+                        DDS_BOOLEAN_TRUE, /* _isCopyable */
+                        NULL, /* _sampleAccessInfo: assigned later */
+                        NULL /* _typePlugin: assigned later */
+                    }}; /* Type code for ShapeTypeExtendedFlat*/
+
+                if (is_initialized) {
+                    return &ShapeTypeExtendedFlat_g_tc;
+                }
+
+                is_initialized = RTI_TRUE;
+
+                ShapeTypeExtendedFlat_g_tc_color_string = initialize_string_typecode((128L));
+
+                ShapeTypeExtendedFlat_g_tc._data._annotations._allowedDataRepresentationMask = 5;
+
+                ShapeTypeExtendedFlat_g_tc_members[0]._representation._typeCode = (RTICdrTypeCode *)&ShapeTypeExtendedFlat_g_tc_color_string;
+                ShapeTypeExtendedFlat_g_tc_members[1]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeExtendedFlat_g_tc_members[2]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeExtendedFlat_g_tc_members[3]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeExtendedFlat_g_tc_members[4]._representation._typeCode = (RTICdrTypeCode *)&::rti::topic::dynamic_type< ::ShapeFillKind>::get().native();
+                ShapeTypeExtendedFlat_g_tc_members[5]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_float;
+
+                /* Initialize the values for member annotations. */
+                ShapeTypeExtendedFlat_g_tc_members[0]._annotations._defaultValue._d = RTI_XCDR_TK_STRING;
+                ShapeTypeExtendedFlat_g_tc_members[0]._annotations._defaultValue._u.string_value = (DDS_Char *) "";
+                ShapeTypeExtendedFlat_g_tc_members[1]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[1]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeExtendedFlat_g_tc_members[1]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[1]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeExtendedFlat_g_tc_members[1]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[1]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeExtendedFlat_g_tc_members[2]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[2]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeExtendedFlat_g_tc_members[2]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[2]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeExtendedFlat_g_tc_members[2]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[2]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeExtendedFlat_g_tc_members[3]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[3]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeExtendedFlat_g_tc_members[3]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[3]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeExtendedFlat_g_tc_members[3]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeExtendedFlat_g_tc_members[3]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeExtendedFlat_g_tc_members[4]._annotations._defaultValue._d = RTI_XCDR_TK_ENUM;
+                ShapeTypeExtendedFlat_g_tc_members[4]._annotations._defaultValue._u.enumerated_value = 0;
+                ShapeTypeExtendedFlat_g_tc_members[5]._annotations._defaultValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeExtendedFlat_g_tc_members[5]._annotations._defaultValue._u.float_value = 0.0f;
+                ShapeTypeExtendedFlat_g_tc_members[5]._annotations._minValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeExtendedFlat_g_tc_members[5]._annotations._minValue._u.float_value = RTIXCdrFloat_MIN;
+                ShapeTypeExtendedFlat_g_tc_members[5]._annotations._maxValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeExtendedFlat_g_tc_members[5]._annotations._maxValue._u.float_value = RTIXCdrFloat_MAX;
+
+                ShapeTypeExtendedFlat_g_tc._data._sampleAccessInfo = sample_access_info();
+                ShapeTypeExtendedFlat_g_tc._data._typePlugin = type_plugin_info();
+
+                return &ShapeTypeExtendedFlat_g_tc;
+            }
+
+            static RTIXCdrSampleAccessInfo * sample_access_info()
+            {
+                static RTIBool is_initialized = RTI_FALSE;
+
+                static RTIXCdrMemberAccessInfo ShapeTypeExtendedFlat_g_memberAccessInfos[6] =
+                {RTIXCdrMemberAccessInfo_INITIALIZER};
+
+                static RTIXCdrSampleAccessInfo ShapeTypeExtendedFlat_g_sampleAccessInfo =
+                RTIXCdrSampleAccessInfo_INITIALIZER;
+
+                if (is_initialized) {
+                    return (RTIXCdrSampleAccessInfo*) &ShapeTypeExtendedFlat_g_sampleAccessInfo;
+                }
+
+                ShapeTypeExtendedFlat_g_sampleAccessInfo.memberAccessInfos =
+                ShapeTypeExtendedFlat_g_memberAccessInfos;
+
+                {
+                    size_t candidateTypeSize = sizeof(::ShapeTypeExtendedFlat);
+
+                    if (candidateTypeSize > RTIXCdrLong_MAX) {
+                        ShapeTypeExtendedFlat_g_sampleAccessInfo.typeSize[0] =
+                        RTIXCdrLong_MAX;
+                    } else {
+                        ShapeTypeExtendedFlat_g_sampleAccessInfo.typeSize[0] =
+                        (RTIXCdrUnsignedLong) candidateTypeSize;
+                    }
+                }
+
+                ShapeTypeExtendedFlat_g_sampleAccessInfo.languageBinding =
+                RTI_XCDR_TYPE_BINDING_FLAT_DATA ;
+
+                is_initialized = RTI_TRUE;
+                return (RTIXCdrSampleAccessInfo*) &ShapeTypeExtendedFlat_g_sampleAccessInfo;
+            }
+            static RTIXCdrTypePlugin * type_plugin_info()
+            {
+                static RTIXCdrTypePlugin ShapeTypeExtendedFlat_g_typePlugin =
+                {
+                    NULL, /* serialize */
+                    NULL, /* serialize_key */
+                    NULL, /* deserialize_sample */
+                    NULL, /* deserialize_key_sample */
+                    NULL, /* skip */
+                    NULL, /* get_serialized_sample_size */
+                    NULL, /* get_serialized_sample_max_size_ex */
+                    NULL, /* get_serialized_key_max_size_ex */
+                    NULL, /* get_serialized_sample_min_size */
+                    NULL, /* serialized_sample_to_key */
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL
+                };
+
+                return &ShapeTypeExtendedFlat_g_typePlugin;
+            }
+        }; // native_type_code
+
+        const ::dds::core::xtypes::StructType& dynamic_type< ::ShapeTypeExtendedFlat >::get()
+        {
+            return static_cast<const ::dds::core::xtypes::StructType&>(
+                ::rti::core::native_conversions::cast_from_native< ::dds::core::xtypes::DynamicType >(
+                    *(native_type_code< ::ShapeTypeExtendedFlat >::get())));
+        }
+    }
+}
+
+namespace dds {
+    namespace topic {
+        void topic_type_support< ::ShapeTypeExtendedFlat >:: register_type(
+            ::dds::domain::DomainParticipant& participant,
+            const std::string& type_name)
+        {
+
+            ::rti::domain::register_type_plugin(
+                participant,
+                type_name,
+                ::ShapeTypeExtendedFlatPlugin_new,
+                ::ShapeTypeExtendedFlatPlugin_delete);
+        }
+
+        std::vector<char>& topic_type_support< ::ShapeTypeExtendedFlat >::to_cdr_buffer(
+            std::vector<char>& buffer,
+            const ::ShapeTypeExtendedFlat& sample,
+            ::dds::core::policy::DataRepresentationId representation)
+        {
+            // First get the length of the buffer
+            unsigned int length = 0;
+            RTIBool ok = ShapeTypeExtendedFlatPlugin_serialize_to_cdr_buffer(
+                NULL,
+                &length,
+                &sample,
+                representation);
+            ::rti::core::check_return_code(
+                ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+                "Failed to calculate cdr buffer size");
+
+            // Create a vector with that size and copy the cdr buffer into it
+            buffer.resize(length);
+            ok = ShapeTypeExtendedFlatPlugin_serialize_to_cdr_buffer(
+                &buffer[0],
+                &length,
+                &sample,
+                representation);
+            ::rti::core::check_return_code(
+                ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+                "Failed to copy cdr buffer");
+
+            return buffer;
+        }
+
+        void topic_type_support< ::ShapeTypeExtendedFlat >::from_cdr_buffer(::ShapeTypeExtendedFlat& sample,
+        const std::vector<char>& buffer)
+        {
+
+            RTIBool ok  = ShapeTypeExtendedFlatPlugin_deserialize_from_cdr_buffer(
+                &sample,
+                &buffer[0],
+                static_cast<unsigned int>(buffer.size()));
+            ::rti::core::check_return_code(ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+            "Failed to create ::ShapeTypeExtendedFlat from cdr buffer");
+        }
+
+        void topic_type_support< ::ShapeTypeExtendedFlat >::reset_sample(::ShapeTypeExtendedFlat&)
+        {
+            // A FlatData sample is reset when it is built again
+        }
+
+        void topic_type_support< ::ShapeTypeExtendedFlat >::allocate_sample(::ShapeTypeExtendedFlat&, int, int)
+        {
+            // A FlatData sample is allocated at its maximum serialized size
+        }
+    }
+}
+
+#endif // NDDS_STANDALONE_TYPE
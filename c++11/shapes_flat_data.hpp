@@ -0,0 +1,265 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_flat_data.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_flat_data.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#ifndef shapes_flat_data_1520431367_hpp
+#define shapes_flat_data_1520431367_hpp
+
+#include <iosfwd>
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, start exporting symbols.
+*/
+#undef RTIUSERDllExport
+#define RTIUSERDllExport __declspec(dllexport)
+#endif
+
+#include "dds/core/SafeEnumeration.hpp"
+#include "dds/core/String.hpp"
+#include "dds/core/array.hpp"
+#include "dds/core/vector.hpp"
+#include "dds/core/External.hpp"
+#include "rti/core/LongDouble.hpp"
+#include "rti/core/Pointer.hpp"
+#include "rti/core/array.hpp"
+#include "rti/topic/TopicTraits.hpp"
+#include "rti/flat/FlatData.hpp"
+
+#include "omg/types/string_view.hpp"
+
+#include "rti/core/BoundedSequence.hpp"
+#include "dds/core/Optional.hpp"
+
+#ifndef NDDS_STANDALONE_TYPE
+#include "dds/domain/DomainParticipant.hpp"
+#include "dds/topic/TopicTraits.hpp"
+#include "dds/core/xtypes/DynamicType.hpp"
+#include "dds/core/xtypes/StructType.hpp"
+#include "dds/core/xtypes/UnionType.hpp"
+#include "dds/core/xtypes/EnumType.hpp"
+#include "dds/core/xtypes/AliasType.hpp"
+#include "rti/util/StreamFlagSaver.hpp"
+#include "rti/domain/PluginSupport.hpp"
+#endif
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, stop exporting symbols.
+*/
+#undef RTIUSERDllExport
+#define RTIUSERDllExport
+#endif
+
+#include "shapes.hpp"
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, start exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport __declspec(dllexport)
+#endif
+
+class NDDSUSERDllExport ShapeTypeExtendedFlatOffset;
+
+/*
+* FlatData sample: the serialized (XCDR2) form of the sample, built in a
+* buffer loaned from the DataWriter and read in place from the DataReader's
+* buffer through root().
+*/
+class NDDSUSERDllExport ShapeTypeExtendedFlat : public ::rti::flat::Sample< ShapeTypeExtendedFlatOffset > {
+};
+
+class NDDSUSERDllExport ShapeTypeExtendedFlatConstOffset : public ::rti::flat::MutableOffset {
+  public:
+    typedef ::rti::flat::MutableOffset Base;
+    typedef ShapeTypeExtendedFlatConstOffset ConstOffset;
+
+    ShapeTypeExtendedFlatConstOffset() {}
+
+    ShapeTypeExtendedFlatConstOffset(
+        const unsigned char *buffer,
+        ::rti::flat::offset_t size)
+        : Base(const_cast<unsigned char *>(buffer), 0, size)
+    {
+    }
+
+    const ::rti::flat::StringOffset color() const;
+
+    int32_t x() const;
+
+    int32_t y() const;
+
+    int32_t shapesize() const;
+
+    ::ShapeFillKind fillKind() const;
+
+    float angle() const;
+
+};
+
+class NDDSUSERDllExport ShapeTypeExtendedFlatOffset : public ::rti::flat::MutableOffset {
+  public:
+    typedef ::rti::flat::MutableOffset Base;
+    typedef ShapeTypeExtendedFlatConstOffset ConstOffset;
+
+    ShapeTypeExtendedFlatOffset() {}
+
+    ShapeTypeExtendedFlatOffset(
+        unsigned char *buffer,
+        ::rti::flat::offset_t size)
+        : Base(buffer, 0, size)
+    {
+    }
+
+    operator ConstOffset() const
+    {
+        return ConstOffset(get_buffer(), get_buffer_size());
+    }
+
+    const ::rti::flat::StringOffset color() const;
+    ::rti::flat::StringOffset color();
+
+    int32_t x() const;
+    bool x(int32_t value);
+
+    int32_t y() const;
+    bool y(int32_t value);
+
+    int32_t shapesize() const;
+    bool shapesize(int32_t value);
+
+    ::ShapeFillKind fillKind() const;
+    bool fillKind(::ShapeFillKind value);
+
+    float angle() const;
+    bool angle(float value);
+
+};
+
+class NDDSUSERDllExport ShapeTypeExtendedFlatBuilder : public ::rti::flat::MutableAggregationBuilder {
+  public:
+    typedef ::rti::flat::MutableAggregationBuilder Base;
+    typedef ShapeTypeExtendedFlatOffset Offset;
+
+    ShapeTypeExtendedFlatBuilder() {}
+
+    ShapeTypeExtendedFlatBuilder(
+        unsigned char *buffer,
+        ::rti::flat::offset_t size,
+        bool initialize_members = false)
+        : Base(::rti::flat::detail::BuilderInitializer(buffer, size), initialize_members)
+    {
+    }
+
+    Offset finish()
+    {
+        return finish_impl<Offset>();
+    }
+
+    ShapeTypeExtendedFlat * finish_sample()
+    {
+        return finish_sample_impl< ShapeTypeExtendedFlat >();
+    }
+
+    ::rti::flat::StringBuilder build_color();
+
+    ShapeTypeExtendedFlatBuilder& add_x(int32_t value);
+
+    ShapeTypeExtendedFlatBuilder& add_y(int32_t value);
+
+    ShapeTypeExtendedFlatBuilder& add_shapesize(int32_t value);
+
+    ShapeTypeExtendedFlatBuilder& add_fillKind(::ShapeFillKind value);
+
+    ShapeTypeExtendedFlatBuilder& add_angle(float value);
+
+};
+
+#ifndef NDDS_STANDALONE_TYPE
+
+namespace rti {
+    namespace flat {
+        namespace topic {
+        }
+
+        template <>
+        struct flat_type_traits< ::ShapeTypeExtendedFlat > {
+            typedef ::ShapeTypeExtendedFlatOffset offset;
+            typedef ::ShapeTypeExtendedFlatBuilder builder;
+        };
+    }
+}
+namespace dds {
+    namespace topic {
+
+        template<>
+        struct topic_type_name< ::ShapeTypeExtendedFlat > {
+            NDDSUSERDllExport static std::string value() {
+                return "ShapeTypeExtendedFlat";
+            }
+        };
+
+        template<>
+        struct is_topic_type< ::ShapeTypeExtendedFlat > : public ::dds::core::true_type {};
+
+        template<>
+        struct topic_type_support< ::ShapeTypeExtendedFlat > {
+            NDDSUSERDllExport
+            static void register_type(
+                ::dds::domain::DomainParticipant& participant,
+                const std::string & type_name);
+
+            NDDSUSERDllExport
+            static std::vector<char>& to_cdr_buffer(
+                std::vector<char>& buffer,
+                const ::ShapeTypeExtendedFlat& sample,
+                ::dds::core::policy::DataRepresentationId representation
+                = ::dds::core::policy::DataRepresentation::auto_id());
+
+            NDDSUSERDllExport
+            static void from_cdr_buffer(::ShapeTypeExtendedFlat& sample, const std::vector<char>& buffer);
+            NDDSUSERDllExport
+            static void reset_sample(::ShapeTypeExtendedFlat& sample);
+
+            NDDSUSERDllExport
+            static void allocate_sample(::ShapeTypeExtendedFlat& sample, int, int);
+
+            static const ::rti::topic::TypePluginKind::type type_plugin_kind =
+            ::rti::topic::TypePluginKind::FLAT_DATA;
+        };
+    }
+}
+
+namespace rti {
+    namespace topic {
+
+        template<>
+        struct dynamic_type< ::ShapeTypeExtendedFlat > {
+            typedef ::dds::core::xtypes::StructType type;
+            NDDSUSERDllExport static const ::dds::core::xtypes::StructType& get();
+        };
+
+        template <>
+        struct extensibility< ::ShapeTypeExtendedFlat > {
+            static const ::dds::core::xtypes::ExtensibilityKind::type kind =
+            ::dds::core::xtypes::ExtensibilityKind::MUTABLE;    };
+
+    }
+}
+
+#endif // NDDS_STANDALONE_TYPE
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, stop exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport
+#endif
+
+#endif // shapes_flat_data_1520431367_hpp
+
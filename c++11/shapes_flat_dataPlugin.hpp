@@ -0,0 +1,253 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_flat_data.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_flat_data.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#ifndef shapes_flat_dataPlugin_1520431367_h
+#define shapes_flat_dataPlugin_1520431367_h
+
+#include "shapes_flat_data.hpp"
+
+struct RTICdrStream;
+
+#ifndef pres_typePlugin_h
+#include "pres/pres_typePlugin.h"
+#endif
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, start exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport __declspec(dllexport)
+#endif
+
+/* The type used to store keys for instances of type struct
+* AnotherSimple.
+*
+* By default, this type is struct ShapeTypeExtendedFlat
+* itself. However, if for some reason this choice is not practical for your
+* system (e.g. if sizeof(struct ShapeTypeExtendedFlat)
+* is very large), you may redefine this typedef in terms of another type of
+* your choosing. HOWEVER, if you define the KeyHolder type to be something
+* other than struct AnotherSimple, the
+* following restriction applies: the key of struct
+* ShapeTypeExtendedFlat must consist of a
+* single field of your redefined KeyHolder type and that field must be the
+* first field in struct ShapeTypeExtendedFlat.
+*/
+typedef class ShapeTypeExtendedFlat ShapeTypeExtendedFlatKeyHolder;
+
+#define ShapeTypeExtendedFlatPlugin_get_sample PRESTypePluginDefaultEndpointData_getSample
+
+#define ShapeTypeExtendedFlatPlugin_get_buffer PRESTypePluginDefaultEndpointData_getBuffer
+#define ShapeTypeExtendedFlatPlugin_return_buffer PRESTypePluginDefaultEndpointData_returnBuffer
+
+#define ShapeTypeExtendedFlatPlugin_get_key PRESTypePluginDefaultEndpointData_getKey
+#define ShapeTypeExtendedFlatPlugin_return_key PRESTypePluginDefaultEndpointData_returnKey
+
+#define ShapeTypeExtendedFlatPlugin_create_sample PRESTypePluginDefaultEndpointData_createSample
+#define ShapeTypeExtendedFlatPlugin_destroy_sample PRESTypePluginDefaultEndpointData_deleteSample
+
+#define ShapeTypeExtendedFlatPlugin_get_writer_loaned_sample PRESTypePluginDefaultEndpointData_getWriterLoanedSample
+#define ShapeTypeExtendedFlatPlugin_return_writer_loaned_sample PRESTypePluginDefaultEndpointData_returnWriterLoanedSample
+#define ShapeTypeExtendedFlatPlugin_return_writer_loaned_sample_from_cookie PRESTypePluginDefaultEndpointData_returnWriterLoanedSampleFromCookie
+#define ShapeTypeExtendedFlatPlugin_validate_writer_loaned_sample PRESTypePluginDefaultEndpointData_validateWriterLoanedSample
+#define ShapeTypeExtendedFlatPlugin_set_writer_loaned_sample_serialized_state PRESTypePluginDefaultEndpointData_setWriterLoanedSampleSerializedState
+
+/* --------------------------------------------------------------------------------------
+Support functions:
+* -------------------------------------------------------------------------------------- */
+
+NDDSUSERDllExport extern ShapeTypeExtendedFlat*
+ShapeTypeExtendedFlatPluginSupport_create_data_w_params(
+    const struct DDS_TypeAllocationParams_t * alloc_params);
+
+NDDSUSERDllExport extern ShapeTypeExtendedFlat*
+ShapeTypeExtendedFlatPluginSupport_create_data_ex(RTIBool allocate_pointers);
+
+NDDSUSERDllExport extern ShapeTypeExtendedFlat*
+ShapeTypeExtendedFlatPluginSupport_create_data(void);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPluginSupport_copy_data(
+    ShapeTypeExtendedFlat *out,
+    const ShapeTypeExtendedFlat *in);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPluginSupport_destroy_data_w_params(
+    ShapeTypeExtendedFlat *sample,
+    const struct DDS_TypeDeallocationParams_t * dealloc_params);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPluginSupport_destroy_data_ex(
+    ShapeTypeExtendedFlat *sample,RTIBool deallocate_pointers);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPluginSupport_destroy_data(
+    ShapeTypeExtendedFlat *sample);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPluginSupport_print_data(
+    const ShapeTypeExtendedFlat *sample,
+    const char *desc,
+    unsigned int indent);
+
+NDDSUSERDllExport extern ShapeTypeExtendedFlat*
+ShapeTypeExtendedFlatPluginSupport_create_key_ex(RTIBool allocate_pointers);
+
+NDDSUSERDllExport extern ShapeTypeExtendedFlat*
+ShapeTypeExtendedFlatPluginSupport_create_key(void);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPluginSupport_destroy_key_ex(
+    ShapeTypeExtendedFlatKeyHolder *key,RTIBool deallocate_pointers);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPluginSupport_destroy_key(
+    ShapeTypeExtendedFlatKeyHolder *key);
+
+/* ----------------------------------------------------------------------------
+Callback functions:
+* ---------------------------------------------------------------------------- */
+
+NDDSUSERDllExport extern PRESTypePluginParticipantData
+ShapeTypeExtendedFlatPlugin_on_participant_attached(
+    void *registration_data,
+    const struct PRESTypePluginParticipantInfo *participant_info,
+    RTIBool top_level_registration,
+    void *container_plugin_context,
+    RTICdrTypeCode *typeCode);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPlugin_on_participant_detached(
+    PRESTypePluginParticipantData participant_data);
+
+NDDSUSERDllExport extern PRESTypePluginEndpointData
+ShapeTypeExtendedFlatPlugin_on_endpoint_attached(
+    PRESTypePluginParticipantData participant_data,
+    const struct PRESTypePluginEndpointInfo *endpoint_info,
+    RTIBool top_level_registration,
+    void *container_plugin_context);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPlugin_on_endpoint_detached(
+    PRESTypePluginEndpointData endpoint_data);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPlugin_return_sample(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeExtendedFlat *sample,
+    void *handle);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_copy_sample(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeExtendedFlat *out,
+    const ShapeTypeExtendedFlat *in);
+
+/* ----------------------------------------------------------------------------
+(De)Serialize functions:
+* ------------------------------------------------------------------------- */
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_serialize_to_cdr_buffer(
+    char * buffer,
+    unsigned int * length,
+    const ShapeTypeExtendedFlat *sample,
+    ::dds::core::policy::DataRepresentationId representation
+    = ::dds::core::policy::DataRepresentation::xcdr());
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_deserialize(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeExtendedFlat **sample,
+    RTIBool * drop_sample,
+    struct RTICdrStream *stream,
+    RTIBool deserialize_encapsulation,
+    RTIBool deserialize_sample,
+    void *endpoint_plugin_qos);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_deserialize_from_cdr_buffer(
+    ShapeTypeExtendedFlat *sample,
+    const char * buffer,
+    unsigned int length);
+
+NDDSUSERDllExport extern unsigned int
+ShapeTypeExtendedFlatPlugin_get_serialized_sample_max_size(
+    PRESTypePluginEndpointData endpoint_data,
+    RTIBool include_encapsulation,
+    RTIEncapsulationId encapsulation_id,
+    unsigned int current_alignment);
+
+/* --------------------------------------------------------------------------------------
+Key Management functions:
+* -------------------------------------------------------------------------------------- */
+NDDSUSERDllExport extern PRESTypePluginKeyKind
+ShapeTypeExtendedFlatPlugin_get_key_kind(void);
+
+NDDSUSERDllExport extern unsigned int
+ShapeTypeExtendedFlatPlugin_get_serialized_key_max_size(
+    PRESTypePluginEndpointData endpoint_data,
+    RTIBool include_encapsulation,
+    RTIEncapsulationId encapsulation_id,
+    unsigned int current_alignment);
+
+NDDSUSERDllExport extern unsigned int
+ShapeTypeExtendedFlatPlugin_get_serialized_key_max_size_for_keyhash(
+    PRESTypePluginEndpointData endpoint_data,
+    RTIEncapsulationId encapsulation_id,
+    unsigned int current_alignment);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_deserialize_key(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeExtendedFlat ** sample,
+    RTIBool * drop_sample,
+    struct RTICdrStream *stream,
+    RTIBool deserialize_encapsulation,
+    RTIBool deserialize_key,
+    void *endpoint_plugin_qos);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_instance_to_key(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeExtendedFlatKeyHolder *key,
+    const ShapeTypeExtendedFlat *instance);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_key_to_instance(
+    PRESTypePluginEndpointData endpoint_data,
+    ShapeTypeExtendedFlat *instance,
+    const ShapeTypeExtendedFlatKeyHolder *key);
+
+NDDSUSERDllExport extern RTIBool
+ShapeTypeExtendedFlatPlugin_serialized_sample_to_keyhash(
+    PRESTypePluginEndpointData endpoint_data,
+    struct RTICdrStream *stream,
+    DDS_KeyHash_t *keyhash,
+    RTIBool deserialize_encapsulation,
+    void *endpoint_plugin_qos);
+
+/* Plugin Functions */
+NDDSUSERDllExport extern struct PRESTypePlugin*
+ShapeTypeExtendedFlatPlugin_new(void);
+
+NDDSUSERDllExport extern void
+ShapeTypeExtendedFlatPlugin_delete(struct PRESTypePlugin *);
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, stop exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport
+#endif
+
+#endif /* shapes_flat_dataPlugin_1520431367_h */
+
@@ -0,0 +1,73 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+// Micro-benchmark of the subscriber's per-sample text formatting: the
+// generated operator<< through a stringstream against shape_format::format()
+// into a fixed buffer. Reports ns per sample and heap allocations per sample.
+//
+// shape_format rounds the angle to 3 decimals where operator<< prints 9
+// significant digits; the sample's angle (12.5) reads the same in both, so
+// the two produce the same text.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include "shapes.hpp"
+#include "shape_format.hpp"
+#include "allocation_counter.hpp"
+
+template <typename Format>
+void run(const char *name, unsigned int iterations, ::ShapeTypeExtended& shape, Format format)
+{
+    size_t total_length = 0;
+    unsigned long long allocations_before = allocation_counter::allocations();
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < iterations; ++i) {
+        shape.x(i % 263);
+        shape.y(i % 278);
+        total_length += format(shape);
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    unsigned long long allocated = allocation_counter::allocations() - allocations_before;
+
+    std::cout << name << ": " << elapsed.count() / iterations << " ns/sample, "
+        << (double) allocated / iterations << " allocations/sample"
+        << " (" << total_length / iterations << " chars)" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int iterations = argc > 1 ? atoi(argv[1]) : 1000000;
+    if (iterations == 0)
+        iterations = 1;
+
+    ::ShapeTypeExtended shape("ORANGE", 0, 0, 30, ShapeFillKind::SOLID_FILL, 12.5f);
+
+    std::cout << "Formatting " << iterations << " ShapeTypeExtended samples" << std::endl;
+
+    run("iostream    ", iterations, shape, [](const ::ShapeTypeExtended& s) {
+        std::stringstream ss;
+        ss << s;
+        return ss.str().size();
+    });
+
+    char buffer[shape_format::MAX_LENGTH];
+    run("shape_format", iterations, shape, [&buffer](const ::ShapeTypeExtended& s) {
+        return shape_format::format(buffer, sizeof(buffer), s);
+    });
+
+    return EXIT_SUCCESS;
+}
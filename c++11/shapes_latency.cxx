@@ -0,0 +1,261 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+// Round-trip latency benchmark for keyed ShapeTypeExtended samples.
+//
+// The ping side writes one sample at a time on "Square" (keyed by its colour,
+// with the sequence number in x) and waits until the pong side has echoed it
+// back on "SquareEcho". Round trips are timed on the ping side with a
+// monotonic clock, so the two sides do not need synchronised clocks. The
+// transport is chosen with a QoS profile restricting the participants to
+// shared memory or UDPv4, e.g. on one host:
+//
+//    shapes_latency --role pong --transport udp
+//    shapes_latency --role ping --transport udp -s 10000
+//
+// -q replaces the transport profile with any other one, e.g. the batching
+// profile, where --flush-per-frame flushes the batch after every write
+// instead of leaving the sample waiting for the batch's flush delay.
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include <dds/pub/ddspub.hpp>
+#include <dds/sub/ddssub.hpp>
+#include <dds/core/ddscore.hpp>
+#include <rti/util/util.hpp>      // for sleep()
+#include <rti/config/Logger.hpp>  // for logging
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "shapes.hpp"
+#include "latency_histogram.hpp"
+#include "data_representation.hpp"
+
+// Round trips measured when -s is not given, after the warm-up ones
+const unsigned int DEFAULT_ROUND_TRIPS = 10000;
+const unsigned int WARMUP_ROUND_TRIPS = 100;
+
+void wait_for_match(
+    dds::pub::DataWriter< ::ShapeTypeExtended>& writer,
+    dds::sub::DataReader< ::ShapeTypeExtended>& reader)
+{
+    std::cout << "Waiting for the other side..." << std::endl;
+    while (!application::shutdown_requested
+            && (writer.publication_matched_status().current_count() == 0
+            || reader.subscription_matched_status().current_count() == 0)) {
+        rti::util::sleep(dds::core::Duration::from_millisecs(100));
+    }
+}
+
+void run_ping(
+    dds::domain::DomainParticipant& participant,
+    const std::string& profile,
+    const std::string& representation,
+    const std::string& transport,
+    unsigned int round_trips,
+    const std::string& color,
+    bool flush)
+{
+    dds::core::QosProvider qos_provider = dds::core::QosProvider::Default();
+
+    dds::topic::Topic< ::ShapeTypeExtended> topic(participant, "Square");
+    dds::topic::Topic< ::ShapeTypeExtended> echo_topic(participant, "SquareEcho");
+
+    dds::pub::qos::DataWriterQos writer_qos = qos_provider.datawriter_qos(profile);
+    dds::sub::qos::DataReaderQos reader_qos = qos_provider.datareader_qos(profile);
+    data_representation::apply(writer_qos, representation);
+    data_representation::apply(reader_qos, representation);
+
+    dds::pub::Publisher publisher(participant);
+    dds::pub::DataWriter< ::ShapeTypeExtended> writer(publisher, topic, writer_qos);
+
+    dds::sub::Subscriber subscriber(participant);
+    dds::sub::DataReader< ::ShapeTypeExtended> echo_reader(subscriber, echo_topic, reader_qos);
+
+    ::ShapeTypeExtended data(color, 0, 0, 30, ShapeFillKind::SOLID_FILL, 0.0f);
+    dds::core::InstanceHandle handle = writer.register_instance(data);
+
+    // The handler timestamps the echo as soon as it is taken
+    typedef std::chrono::steady_clock clock;
+    clock::time_point sent, received;
+    int32_t expected = -1;
+    bool echoed = false;
+
+    dds::sub::cond::ReadCondition echo_condition(
+        echo_reader,
+        dds::sub::status::DataState::any(),
+        [&]() {
+            dds::sub::LoanedSamples< ::ShapeTypeExtended> samples = echo_reader.take();
+            for (const auto& sample : samples) {
+                if (sample.info().valid()
+                        && sample.data().x() == expected
+                        && sample.data().color() == color) {
+                    received = clock::now();
+                    echoed = true;
+                }
+            }
+        });
+
+    dds::core::cond::WaitSet waitset;
+    waitset += echo_condition;
+
+    wait_for_match(writer, echo_reader);
+
+    LatencyHistogram<> round_trip_ns;
+    unsigned int lost = 0;
+    unsigned int total = WARMUP_ROUND_TRIPS + round_trips;
+
+    for (unsigned int i = 0; i < total && !application::shutdown_requested; ++i) {
+        expected = (int32_t) i;
+        echoed = false;
+        data.x(expected);
+
+        sent = clock::now();
+        writer.write(data, handle);
+        if (flush)
+            writer->flush();
+
+        // Give up on this round trip after a second without the echo
+        while (!echoed && clock::now() - sent < std::chrono::seconds(1))
+            waitset.dispatch(dds::core::Duration::from_millisecs(100));
+
+        if (!echoed) {
+            ++lost;
+        } else if (i >= WARMUP_ROUND_TRIPS) {
+            round_trip_ns.record(std::chrono::duration_cast<std::chrono::nanoseconds>(received - sent).count());
+        }
+    }
+
+    writer.dispose_instance(handle);
+
+    printf("Round trip over %s with %s, %llu samples (%u lost)\n", transport.c_str(),
+        data_representation::label(representation), (unsigned long long) round_trip_ns.count(), lost);
+    printf("    p50: %8.1f us\n", round_trip_ns.percentile(50.0) / 1000.0);
+    printf("    p90: %8.1f us\n", round_trip_ns.percentile(90.0) / 1000.0);
+    printf("    p99: %8.1f us\n", round_trip_ns.percentile(99.0) / 1000.0);
+    printf("  p99.9: %8.1f us\n", round_trip_ns.percentile(99.9) / 1000.0);
+    printf("    max: %8.1f us\n", round_trip_ns.max() / 1000.0);
+}
+
+void run_pong(
+    dds::domain::DomainParticipant& participant,
+    const std::string& profile,
+    const std::string& representation,
+    bool flush)
+{
+    dds::core::QosProvider qos_provider = dds::core::QosProvider::Default();
+
+    dds::topic::Topic< ::ShapeTypeExtended> topic(participant, "Square");
+    dds::topic::Topic< ::ShapeTypeExtended> echo_topic(participant, "SquareEcho");
+
+    dds::sub::qos::DataReaderQos reader_qos = qos_provider.datareader_qos(profile);
+    dds::pub::qos::DataWriterQos writer_qos = qos_provider.datawriter_qos(profile);
+    data_representation::apply(reader_qos, representation);
+    data_representation::apply(writer_qos, representation);
+
+    dds::sub::Subscriber subscriber(participant);
+    dds::sub::DataReader< ::ShapeTypeExtended> reader(subscriber, topic, reader_qos);
+
+    dds::pub::Publisher publisher(participant);
+    dds::pub::DataWriter< ::ShapeTypeExtended> echo_writer(publisher, echo_topic, writer_qos);
+
+    // Echo every valid sample back as is
+    unsigned int echoed = 0;
+    dds::sub::cond::ReadCondition read_condition(
+        reader,
+        dds::sub::status::DataState::any(),
+        [&]() {
+            dds::sub::LoanedSamples< ::ShapeTypeExtended> samples = reader.take();
+            for (const auto& sample : samples) {
+                if (sample.info().valid()) {
+                    echo_writer.write(sample.data());
+                    ++echoed;
+                }
+            }
+            if (flush)
+                echo_writer->flush();
+        });
+
+    dds::core::cond::WaitSet waitset;
+    waitset += read_condition;
+
+    wait_for_match(echo_writer, reader);
+    std::cout << "Echoing, press Ctrl-C to stop" << std::endl;
+
+    while (!application::shutdown_requested)
+        waitset.dispatch(dds::core::Duration(1));
+
+    std::cout << "Echoed " << echoed << " samples" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    // Sets Connext verbosity to help debugging
+    rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+    if (arguments.transport != "shmem" && arguments.transport != "udp") {
+        std::cerr << "Unknown transport " << arguments.transport << ", use shmem or udp" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (arguments.role.empty())
+        arguments.role = "ping";
+    if (arguments.role != "ping" && arguments.role != "pong") {
+        std::cerr << "Unknown role " << arguments.role << ", use ping or pong" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string profile = arguments.qos_profile.empty()
+        ? "shapes_Library::latency_" + arguments.transport
+        : arguments.qos_profile;
+
+    unsigned int round_trips = arguments.sample_count;
+    if (round_trips == (std::numeric_limits<unsigned int>::max)())
+        round_trips = DEFAULT_ROUND_TRIPS;
+
+    try {
+        dds::domain::DomainParticipant participant(
+            arguments.domain_id,
+            dds::core::QosProvider::Default().participant_qos(profile));
+
+        if (arguments.role == "ping")
+            run_ping(participant, profile, arguments.data_representation,
+                arguments.qos_profile.empty() ? arguments.transport : profile,
+                round_trips, arguments.color, arguments.flush_per_frame);
+        else
+            run_pong(participant, profile, arguments.data_representation, arguments.flush_per_frame);
+    } catch (const std::exception& ex) {
+        // This will catch DDS exceptions
+        std::cerr << "Exception in shapes_latency: " << ex.what()
+        << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Releases the memory used by the participant factory.  Optional at
+    // application exit
+    dds::domain::DomainParticipant::finalize_participant_factory();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,224 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+// Benchmark of the ways the subscriber can walk the LoanedSamples of a
+// take(), at a steady publication rate (-r, 100000 samples/s by default):
+//
+//    by value      for (auto sample : samples)
+//    by reference  for (const auto& sample : samples)
+//    deep copy     ShapeTypeExtended copy = sample.data() for every sample
+//
+// A DataWriter and a DataReader in this process exchange ShapeTypeExtended
+// samples on "SquareLoanBench" over -i instances. Each mode processes -s
+// samples (300000 by default) and reports the ns and heap allocations per
+// sample spent in the loop, take() excluded. The QoS comes from -q,
+// shapes_Library::throughput_reliable by default.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dds/pub/ddspub.hpp>
+#include <dds/sub/ddssub.hpp>
+#include <dds/core/ddscore.hpp>
+#include <rti/config/Logger.hpp>  // for logging
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "shapes.hpp"
+#include "pacing.hpp"
+#include "allocation_counter.hpp"
+
+const char *DEFAULT_PROFILE = "shapes_Library::throughput_reliable";
+const double DEFAULT_RATE = 100000.0;
+const unsigned int DEFAULT_SAMPLES_PER_MODE = 300000;
+
+enum class Mode {
+    by_value,
+    by_reference,
+    deep_copy
+};
+
+const char *mode_name(Mode mode)
+{
+    switch (mode) {
+    case Mode::by_value:
+        return "by value";
+    case Mode::by_reference:
+        return "by reference";
+    default:
+        return "deep copy";
+    }
+}
+
+// What process_data reads from a valid sample
+inline int64_t use(const ::ShapeTypeExtended& shape, const dds::sub::SampleInfo& info)
+{
+    return shape.x() + shape.y() + (int64_t) shape.color().size() + info.source_timestamp().sec();
+}
+
+// Totals of the samples processed in one mode
+struct Totals {
+    unsigned long long samples = 0;
+    unsigned long long allocations = 0;
+    double ns = 0.0;
+    int64_t checksum = 0;  // keeps the loops from being optimized away
+};
+
+void process(const dds::sub::LoanedSamples< ::ShapeTypeExtended>& samples, Mode mode, Totals& totals)
+{
+    unsigned long long allocations_before = allocation_counter::allocations();
+    auto start = std::chrono::steady_clock::now();
+
+    unsigned long long count = 0;
+    if (mode == Mode::by_value) {
+        for (auto sample : samples) {
+            if (sample.info().valid()) {
+                totals.checksum += use(sample.data(), sample.info());
+                ++count;
+            }
+        }
+    } else if (mode == Mode::by_reference) {
+        for (const auto& sample : samples) {
+            if (sample.info().valid()) {
+                totals.checksum += use(sample.data(), sample.info());
+                ++count;
+            }
+        }
+    } else {
+        for (const auto& sample : samples) {
+            if (sample.info().valid()) {
+                ::ShapeTypeExtended copy = sample.data();
+                totals.checksum += use(copy, sample.info());
+                ++count;
+            }
+        }
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    totals.ns += elapsed.count();
+    totals.allocations += allocation_counter::allocations() - allocations_before;
+    totals.samples += count;
+}
+
+// Writes round-robin over the instances at the requested rate until stop
+void write_loop(
+    dds::pub::DataWriter< ::ShapeTypeExtended> writer,
+    std::vector< ::ShapeTypeExtended> samples,
+    double rate,
+    const std::atomic<bool>& stop)
+{
+    pacing::Pacer pacer(rate);
+    std::vector<dds::core::InstanceHandle> handles;
+    for (const auto& sample : samples)
+        handles.push_back(writer.register_instance(sample));
+
+    for (unsigned long long written = 0; !stop; ++written) {
+        pacer.wait();
+        size_t index = written % samples.size();
+        samples[index].x((int32_t) (written % 263));
+        samples[index].y((int32_t) (written % 278));
+        writer.write(samples[index], handles[index]);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    // Sets Connext verbosity to help debugging
+    rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+    const std::string profile = arguments.qos_profile.empty() ? DEFAULT_PROFILE : arguments.qos_profile;
+    const double rate = arguments.rate > 0 ? arguments.rate : DEFAULT_RATE;
+    const unsigned int samples_per_mode =
+        arguments.sample_count == (std::numeric_limits<unsigned int>::max)()
+        ? DEFAULT_SAMPLES_PER_MODE : arguments.sample_count;
+
+    const Mode modes[] = { Mode::by_value, Mode::by_reference, Mode::deep_copy };
+    Totals totals[3];
+
+    try {
+        dds::core::QosProvider qos_provider = dds::core::QosProvider::Default();
+        dds::domain::DomainParticipant participant(arguments.domain_id, qos_provider.participant_qos(profile));
+        dds::topic::Topic< ::ShapeTypeExtended> topic(participant, "SquareLoanBench");
+
+        dds::sub::Subscriber subscriber(participant);
+        dds::sub::DataReader< ::ShapeTypeExtended> reader(subscriber, topic, qos_provider.datareader_qos(profile));
+        dds::pub::Publisher publisher(participant);
+        dds::pub::DataWriter< ::ShapeTypeExtended> writer(publisher, topic, qos_provider.datawriter_qos(profile));
+
+        std::vector< ::ShapeTypeExtended> samples;
+        for (unsigned int i = 0; i < arguments.instance_count; ++i)
+            samples.emplace_back(colours::instance_key(arguments.color, i), 0, 0, 30, ShapeFillKind::SOLID_FILL, 0.0f);
+
+        size_t current = 0;
+        dds::sub::cond::ReadCondition read_condition(
+            reader,
+            dds::sub::status::DataState::any(),
+            [&]() { process(reader.take(), modes[current], totals[current]); });
+        dds::core::cond::WaitSet waitset;
+        waitset += read_condition;
+
+        std::cout << "Processing " << samples_per_mode << " samples per mode at " << rate
+            << " samples/s over " << samples.size() << " instances" << std::endl;
+
+        std::atomic<bool> stop(false);
+        std::thread writer_thread(write_loop, writer, samples, rate, std::cref(stop));
+        try {
+            while (!application::shutdown_requested && current < 3) {
+                waitset.dispatch(dds::core::Duration::from_millisecs(100));
+                if (totals[current].samples >= samples_per_mode)
+                    ++current;
+            }
+        } catch (...) {
+            stop = true;
+            writer_thread.join();
+            throw;
+        }
+        stop = true;
+        writer_thread.join();
+    } catch (const std::exception& ex) {
+        // This will catch DDS exceptions
+        std::cerr << "Exception in shapes_loan_bench: " << ex.what()
+        << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    printf("%-14s %10s %10s %12s\n", "mode", "samples", "ns/sample", "allocs/sample");
+    for (size_t i = 0; i < 3; ++i) {
+        const Totals& t = totals[i];
+        printf("%-14s %10llu %10.1f %12.3f\n", mode_name(modes[i]), t.samples,
+            t.samples > 0 ? t.ns / t.samples : 0.0,
+            t.samples > 0 ? (double) t.allocations / t.samples : 0.0);
+    }
+
+    // Releases the memory used by the participant factory.  Optional at
+    // application exit
+    dds::domain::DomainParticipant::finalize_participant_factory();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+// Micro-benchmark of the generated ShapeTypeExtended type plugin
+// (shapesPlugin.cxx): serialization, deserialization, key extraction, key
+// hashing and sample copies, for keys of 1 to 128 characters. Reports ns and
+// heap allocations per operation, so a regenerated plugin can be compared
+// with the previous one.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "ndds/ndds_c.h"
+#include "cdr/cdr_stream.h"
+
+#include "shapes.hpp"
+#include "shapesPlugin.hpp"
+#include "allocation_counter.hpp"
+
+// Serialized ShapeTypeExtended samples are at most about 170 bytes
+static const unsigned int BUFFER_SIZE = 512;
+
+template <typename Operation>
+bool run(const char *name, size_t key_length, unsigned int iterations, Operation operation)
+{
+    unsigned long long allocations_before = allocation_counter::allocations();
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < iterations; ++i) {
+        if (!operation()) {
+            std::cerr << name << " failed for a key of " << key_length << " characters" << std::endl;
+            return false;
+        }
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    unsigned long long allocated = allocation_counter::allocations() - allocations_before;
+
+    printf("%-16s %4zu %12.1f %12.3f\n", name, key_length,
+        elapsed.count() / iterations, (double) allocated / iterations);
+    return true;
+}
+
+// Runs every operation on a sample whose key has key_length characters
+bool run_all(PRESTypePluginEndpointData endpoint_data, size_t key_length, unsigned int iterations)
+{
+    ::ShapeTypeExtended sample(std::string(key_length, 'K'), 10, 20, 30, ShapeFillKind::SOLID_FILL, 12.5f);
+    ::ShapeTypeExtended target;
+    ::ShapeTypeExtendedKeyHolder key;
+    ::rti::topic::allocate_sample(target);
+    ::rti::topic::allocate_sample(key);
+
+    char buffer[BUFFER_SIZE];
+    unsigned int length = BUFFER_SIZE;
+    if (!ShapeTypeExtendedPlugin_serialize_to_cdr_buffer(buffer, &length, &sample)) {
+        std::cerr << "Cannot serialize a key of " << key_length << " characters" << std::endl;
+        return false;
+    }
+
+    struct RTICdrStream stream;
+    DDS_KeyHash_t keyhash;
+
+    return run("serialize", key_length, iterations, [&]() {
+            unsigned int serialized_length = BUFFER_SIZE;
+            return ShapeTypeExtendedPlugin_serialize_to_cdr_buffer(buffer, &serialized_length, &sample)
+                == RTI_TRUE;
+        })
+        && run("deserialize", key_length, iterations, [&]() {
+            return ShapeTypeExtendedPlugin_deserialize_from_cdr_buffer(&target, buffer, length) == RTI_TRUE;
+        })
+        && run("instance_to_key", key_length, iterations, [&]() {
+            return ShapeTypeExtendedPlugin_instance_to_key(endpoint_data, &key, &sample) == RTI_TRUE;
+        })
+        && run("key_to_instance", key_length, iterations, [&]() {
+            return ShapeTypeExtendedPlugin_key_to_instance(endpoint_data, &target, &key) == RTI_TRUE;
+        })
+        && run("keyhash", key_length, iterations, [&]() {
+            RTICdrStream_init(&stream);
+            RTICdrStream_set(&stream, buffer, length);
+            return ShapeTypeExtendedPlugin_serialized_sample_to_keyhash(
+                endpoint_data, &stream, &keyhash, RTI_TRUE, NULL) == RTI_TRUE;
+        })
+        && run("copy_sample", key_length, iterations, [&]() {
+            return ShapeTypeExtendedPlugin_copy_sample(endpoint_data, &target, &sample) == RTI_TRUE;
+        });
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int iterations = argc > 1 ? atoi(argv[1]) : 1000000;
+    if (iterations == 0)
+        iterations = 1;
+
+    // The key and keyhash functions need the endpoint data a DataReader
+    // would attach; the plugin's own callbacks create it outside of any
+    // participant
+    struct PRESTypePluginParticipantInfo participant_info;
+    memset(&participant_info, 0, sizeof(participant_info));
+    PRESTypePluginParticipantData participant_data =
+        ShapeTypeExtendedPlugin_on_participant_attached(NULL, &participant_info, RTI_TRUE, NULL, NULL);
+    if (participant_data == NULL) {
+        std::cerr << "Cannot attach the type plugin" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    struct PRESTypePluginEndpointInfo endpoint_info;
+    memset(&endpoint_info, 0, sizeof(endpoint_info));
+    endpoint_info.endpointKind = PRES_TYPEPLUGIN_ENDPOINT_READER;
+    PRESTypePluginEndpointData endpoint_data =
+        ShapeTypeExtendedPlugin_on_endpoint_attached(participant_data, &endpoint_info, RTI_TRUE, NULL);
+    if (endpoint_data == NULL) {
+        ShapeTypeExtendedPlugin_on_participant_detached(participant_data);
+        std::cerr << "Cannot attach a reader endpoint to the type plugin" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Running each ShapeTypeExtended plugin operation " << iterations << " times" << std::endl;
+    printf("%-16s %4s %12s %12s\n", "operation", "key", "ns/op", "allocs/op");
+
+    const size_t key_lengths[] = { 1, 8, 16, 32, 64, 128 };
+    bool ok = true;
+    for (size_t key_length : key_lengths) {
+        if (!run_all(endpoint_data, key_length, iterations)) {
+            ok = false;
+            break;
+        }
+    }
+
+    ShapeTypeExtendedPlugin_on_endpoint_detached(endpoint_data);
+    ShapeTypeExtendedPlugin_on_participant_detached(participant_data);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -27,61 +27,141 @@
 
 #include "application.hpp"  // for command line parsing and ctrl-c
 #include "shapes.hpp"
+#include "pacing.hpp"
+#include "async_log.hpp"
+#include "shape_writers.hpp"
+#include "data_representation.hpp"
+#include "content_filter.hpp"
 #include <cmath>
-
-void run_publisher_application(unsigned int domain_id, unsigned int sample_count, const std::string& color)
+#include <stdexcept>
+#include <vector>
+
+// Trajectory of one keyed instance
+struct PublishedInstance {
+    int x;
+    float phase;
+};
+
+template <typename ShapeWriter>
+void publish(
+    dds::domain::DomainParticipant& participant,
+    dds::pub::Publisher& publisher,
+    const dds::pub::qos::DataWriterQos& writer_qos,
+    const application::ApplicationArguments& arguments)
 {
-    // DDS objects behave like shared pointers or value types
-    // (see https://community.rti.com/best-practices/use-modern-c-types-correctly)
+    const int left = 15, top = 15, right = 248, bottom = 278; // limits
+    const int shape_size = 30;
+    const float AMPLITUDE = 100.0f;
+    const float FREQUENCY = 0.0475f;
+    const float PI = 3.14159265f;
+    const unsigned int instance_count = arguments.instance_count;
+    const unsigned int sample_count = arguments.sample_count;
+
+    // All instances are written through the same DataWriter. Each one starts
+    // at a different point of the screen and follows its own phase-shifted
+    // sine wave so the updates are not identical.
+    std::vector<std::string> keys;
+    std::vector<PublishedInstance> instances(instance_count);
+    for (unsigned int i = 0; i < instance_count; ++i) {
+        keys.push_back(colours::instance_key(arguments.color, i));
+        instances[i].x = left - shape_size + (int)(i * (right - left + shape_size) / instance_count);
+        instances[i].phase = 2.0f * PI * i / instance_count;
+    }
 
-    // Start communicating in a domain, usually one participant per application
-    dds::domain::DomainParticipant participant(domain_id);
+    ShapeWriter writer(participant, publisher, writer_qos, keys, shape_size, true);
 
-    // Create a Topic with a name and a datatype
-    dds::topic::Topic< ::ShapeTypeExtended> topic(participant, "Square");
+    // Negative rate means the original demo pace of one update per instance
+    // per second
+    pacing::Pacer pacer(arguments.rate < 0 ? (double)instance_count : arguments.rate);
 
-    // Create a Publisher
-    dds::pub::Publisher publisher(participant);
+    // Console output is drained by a background thread so the write loop
+    // never waits on stdout
+    async_log::AsyncLog log(4096, async_log::stdout_sink(), async_log::stdout_flush(), arguments.log_every);
 
-    // Create a DataWriter with default QoS
-    dds::pub::DataWriter< ::ShapeTypeExtended> writer(publisher, topic);
+    // Main loop, write data
+    unsigned int samples_written = 0;
+    while (!application::shutdown_requested && samples_written < sample_count) {
 
-    ::ShapeTypeExtended data;
+        for (unsigned int i = 0; i < instance_count; ++i) {
+            if (application::shutdown_requested || samples_written >= sample_count)
+                break;
 
-    // Tell Connext that we will be modifying a particular instance
-    dds::core::InstanceHandle instance_handle = writer.register_instance(data);
+            PublishedInstance& instance = instances[i];
+            if (++instance.x > right)
+              instance.x = left-shape_size;
 
-    const int left = 15, top = 15, right = 248, bottom = 278; // limits
-    const int shape_size = 30;
-    int x = left-shape_size, y = bottom - top / 2;
-    const float AMPLITUDE = 100.0f;
-    const float FREQUENCY = 0.0475f;
+            int y = (int)(bottom - top) / 2 + AMPLITUDE * std::sin(FREQUENCY * instance.x + instance.phase);
 
-    data.color(color);
-    data.shapesize(shape_size);
-    data.fillKind(ShapeFillKind::SOLID_FILL);
-    
-    // Main loop, write data
-    unsigned int samples_written = 0;
-    for (; !application::shutdown_requested && samples_written < sample_count; ++samples_written) {
+            if (log.sampled()) {
+                log.log("Writing a %s square at (%d,%d), count: %u",
+                    keys[i].c_str(), instance.x, y, samples_written);
+            }
 
-        if (++x > right)
-          x = left-shape_size;
+            writer.write(i, instance.x, y);
+            ++samples_written;
 
-        y = (int)(bottom - top) / 2 + AMPLITUDE * std::sin(FREQUENCY * x);
-        
-        data.x(x);
-        data.y(y);
+            pacer.wait();
+        }
 
-        std::cout << "Writing a " << color << " square at (" << x << "," << y << "), count: " << samples_written << std::endl;
-        
-        writer.write(data);
+        // With a batching profile, send what this round of updates queued
+        // instead of waiting for the batch to fill or its flush delay
+        if (arguments.flush_per_frame)
+            writer.flush();
+    }
 
-        rti::util::sleep(dds::core::Duration(1));
+    log.stop();
+    if (log.dropped() > 0 || log.sampled_out() > 0) {
+        std::cout << "Log lines written: " << log.logged() << ", dropped: " << log.dropped()
+            << ", sampled out: " << log.sampled_out() << std::endl;
     }
 
-    // de-register instance
-    writer.dispose_instance(instance_handle);
+    if (pacer.requested_rate() > 0) {
+        std::cout << "Requested rate: " << pacer.requested_rate() << " samples/s, achieved: "
+            << pacer.achieved_rate() << " samples/s" << std::endl;
+    } else {
+        std::cout << "Unthrottled, achieved: " << pacer.achieved_rate() << " samples/s" << std::endl;
+    }
+
+    // de-register instances
+    writer.dispose_all();
+}
+
+void run_publisher_application(const application::ApplicationArguments& arguments)
+{
+    // DDS objects behave like shared pointers or value types
+    // (see https://community.rti.com/best-practices/use-modern-c-types-correctly)
+
+    // Every entity takes its QoS from the requested profile, or from the
+    // default profile in USER_QOS_PROFILES.xml when none is given
+    dds::core::QosProvider qos_provider = dds::core::QosProvider::Default();
+    const std::string& qos_profile = arguments.qos_profile;
+    const bool use_default = qos_profile.empty();
+
+    // Start communicating in a domain, usually one participant per application
+    dds::domain::DomainParticipant participant(
+        arguments.domain_id,
+        use_default ? qos_provider.participant_qos() : qos_provider.participant_qos(qos_profile));
+
+    // Create a Publisher
+    dds::pub::Publisher publisher(participant);
+
+    // The Topic and DataWriter are created for the requested data type
+    dds::pub::qos::DataWriterQos writer_qos =
+        use_default ? qos_provider.datawriter_qos() : qos_provider.datawriter_qos(qos_profile);
+    data_representation::apply(writer_qos, arguments.data_representation);
+    content_filter::enable_writer_filtering(writer_qos);
+
+    if (arguments.data_type == "extended") {
+        publish<shape_writers::SampleWriter< ::ShapeTypeExtended>>(participant, publisher, writer_qos, arguments);
+    } else if (arguments.data_type == "zero_copy") {
+        publish<shape_writers::LoanedSampleWriter>(participant, publisher, writer_qos, arguments);
+    } else if (arguments.data_type == "flat_data") {
+        publish<shape_writers::FlatSampleWriter>(participant, publisher, writer_qos, arguments);
+    } else if (arguments.data_type == "compact_key") {
+        publish<shape_writers::SampleWriter< ::ShapeTypeCompactKey>>(participant, publisher, writer_qos, arguments);
+    } else {
+        throw std::invalid_argument("unknown data type " + arguments.data_type);
+    }
 }
 
 int main(int argc, char *argv[])
@@ -102,7 +182,7 @@ int main(int argc, char *argv[])
     rti::config::Logger::instance().verbosity(arguments.verbosity);
 
     try {
-        run_publisher_application(arguments.domain_id, arguments.sample_count, arguments.color);
+        run_publisher_application(arguments);
     } catch (const std::exception& ex) {
         // This will catch DDS exceptions
         std::cerr << "Exception in run_publisher_application(): " << ex.what()
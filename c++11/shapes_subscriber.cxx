@@ -11,8 +11,16 @@
 */
 
 #include <algorithm>
-#include <sstream>
-#include <deque>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <memory>
+#include <stdexcept>
 
 #include <dds/sub/ddssub.hpp>
 #include <dds/core/ddscore.hpp>
@@ -31,155 +39,823 @@
 #include <ncurses.h>
 
 #include "shapes.hpp"
+#include "shape_types.hpp"
 #include "application.hpp"  // for command line parsing and ctrl-c
+#include "async_log.hpp"
+#include "pacing.hpp"
+#include "instance_handle_hash.hpp"
+#include "shape_format.hpp"
+#include "latency_histogram.hpp"
+#include "sample_pool.hpp"
+#include "allocation_counter.hpp"
+#include "data_representation.hpp"
+#include "content_filter.hpp"
 
 using std::cout;
 using std::endl;
-using std::deque;
 using std::string;
-using std::stringstream;
+
+// Latest-value profile of --state
+const char *STATE_PROFILE = "shapes_Library::state_reliable";
 
 #define COLOR_PURPLE COLOR_WHITE + 1
 #define COLOR_ORANGE COLOR_WHITE + 2
 
-static deque<string> log_data;
-static const int log_y = 20;
-void display_log(const string& logline) {
+// All drawing happens in the render thread. display_log(), display_sample()
+// and display_stats() only stage text into the ncurses virtual screen, the
+// render loop flushes it to the terminal with a single refresh() per frame.
+
+// Instance-change log at the bottom of the screen.
+//
+// Lines are copied into a preallocated ring of fixed-width lines, so logging
+// an event never allocates. The log area is an ncurses scroll region: showing
+// a new line scrolls the region by one and draws that line only, instead of
+// repainting every line. When more lines arrive in one frame than the area
+// can hold, only the newest ones are drawn and the rest are counted as
+// coalesced.
+class LogView {
+  public:
+    LogView() : top_(0), depth_(0), head_(0), used_(0), pending_(0), coalesced_(0) {}
+
+    // Must be called after initscr(). depth is clamped to the screen height.
+    void init(int top, unsigned int depth)
+    {
+        top_ = top;
+        depth_ = depth;
+        if (top_ + (int) depth_ > LINES)
+            depth_ = LINES > top_ ? LINES - top_ : 1;
+        if (depth_ == 0)
+            depth_ = 1;
+        lines_.assign(depth_, Line());
+
+        setscrreg(top_, top_ + depth_ - 1);
+        scrollok(stdscr, TRUE);
+    }
 
-    log_data.push_back(logline);
-    if (log_data.size() > 5)
-        log_data.pop_front();
+    void add(const char *line)
+    {
+        strncpy(lines_[head_].data(), line, async_log::LINE_SIZE - 1);
+        lines_[head_][async_log::LINE_SIZE - 1] = '\0';
+        head_ = (head_ + 1) % depth_;
+        ++pending_;
+    }
 
-    int cur_y = log_y;
-    for (const auto &s : log_data) {
-        mvaddstr(cur_y++, 0, s.c_str());
+    // Stages the lines added since the last call, returns false if there
+    // were none
+    bool draw()
+    {
+        if (pending_ == 0)
+            return false;
+
+        unsigned int shown = pending_ < depth_ ? pending_ : depth_;
+        coalesced_ += pending_ - shown;
+
+        for (unsigned int i = shown; i > 0; --i) {
+            int row;
+            if (used_ < depth_) {
+                row = top_ + used_++;
+            } else {
+                scrl(1);
+                row = top_ + depth_ - 1;
+            }
+            // Stay off the last column so the cursor never wraps and scrolls
+            mvaddnstr(row, 0, lines_[(head_ + depth_ - i) % depth_].data(), COLS - 1);
+            clrtoeol();
+        }
+
+        pending_ = 0;
+        return true;
     }
 
-    refresh();    
+    unsigned long long coalesced() const { return coalesced_; }
+
+  private:
+    typedef std::array<char, async_log::LINE_SIZE> Line;
+
+    std::vector<Line> lines_;
+    int top_;
+    unsigned int depth_;
+    unsigned int head_;
+    unsigned int used_;
+    unsigned int pending_;
+    unsigned long long coalesced_;
+};
+
+static LogView log_view;
+static const int log_y = 20;
+void display_log(const char *logline) {
+
+    log_view.add(logline);
 }
 
-void display_sample(const ShapeTypeExtended& shape) {
+static const int stats_y = log_y - 1;
+void display_stats(double refreshes_per_second, double samples_per_refresh, const LatencyHistogram<>& latency) {
+
+    char text[160];
+    snprintf(text, sizeof(text),
+        "refreshes/s: %.1f  samples/refresh: %.1f  log lines coalesced: %llu  "
+        "latency us p50: %llu p99: %llu p99.9: %llu max: %llu",
+        refreshes_per_second, samples_per_refresh, log_view.coalesced(),
+        (unsigned long long) latency.percentile(50.0), (unsigned long long) latency.percentile(99.0),
+        (unsigned long long) latency.percentile(99.9), (unsigned long long) latency.max());
+    // Clipped like the log lines: a wrapped line would spill into the log
+    // scroll region
+    mvaddnstr(stats_y, 0, text, COLS - 1);
+    clrtoeol();
+}
+
+void display_sample(int row, int c, const ShapeTypeExtended& shape) {
     
+    if (has_colors()) {
+        attron(COLOR_PAIR(c));
+        if (c == colours::YELLOW || c == colours::ORANGE)
+            attron(A_BOLD);
+    }
+
+    mvaddstr(row, 0, shape.color().c_str());
+    if (has_colors()) {
+        attroff(COLOR_PAIR(c));
+        attroff(A_BOLD);
+    }
+    
+    char text[shape_format::MAX_LENGTH];
+    shape_format::format(text, sizeof(text), shape);
+    mvaddstr(row, 10, text);
+}
+
+// Latest value of each instance. The reader thread only stores samples here,
+// the render thread draws whatever changed since its last frame, so taking
+// samples never waits on the terminal.
+//
+// Slots are found through a hash table keyed by instance handle, filled the
+// first time an instance is seen, so the per-sample lookup does not depend on
+// the number of instances. Plain colours keep their own row, other keys (e.g.
+// BLUE_1 from a multi-instance publisher) take the free rows above the log
+// area; instances that do not fit on screen are tracked but not drawn.
+//
+// Each slot also counts what was received for its instance, which is what the
+// headless mode reports. Latency from the writer's source timestamp to
+// reception is recorded per instance (in instance_latency, parallel to the
+// slots so that copying a slot does not copy its histogram) and globally.
+// The headless reports take the histogram of each instance in exchange for
+// an empty one, so per instance it covers the samples since the previous
+// report; without them it covers the whole run.
+struct InstanceSlot {
+    ShapeTypeExtended shape;
+    int row;
+    int colour;
+    bool dirty;
+    unsigned long long samples;
+    unsigned long long bytes;
+    unsigned long long state_changes;
+};
+
+static std::mutex table_mutex;
+static std::vector<InstanceSlot> instance_slots;
+static std::unordered_map<dds::core::InstanceHandle, size_t, InstanceHandleHash> instance_index;
+static std::vector<size_t> dirty_slots;
+static std::vector<std::unique_ptr<LatencyHistogram<5>>> instance_latency;
+static LatencyHistogram<> total_latency;
+static int next_free_row = colours::MAX_COLOUR;
+
+InstanceSlot make_slot(const ShapeTypeExtended& shape) {
+
+    InstanceSlot slot;
+    slot.shape = shape;
+    slot.row = -1;
+    slot.colour = colours::BLUE;
+    slot.dirty = false;
+    slot.samples = 0;
+    slot.bytes = 0;
+    slot.state_changes = 0;
+
     for (int c = colours::MIN_COLOUR; c != colours::MAX_COLOUR; c++) {
         if (0 == shape.color().compare(colours::ToStr[c])) {
+            slot.row = slot.colour = c;
+            return slot;
+        }
+    }
+
+    for (int c = colours::MIN_COLOUR; c != colours::MAX_COLOUR; c++) {
+        if (0 == shape.color().compare(0, colours::ToStr[c].size(), colours::ToStr[c])) {
+            slot.colour = c;
+            break;
+        }
+    }
+    if (next_free_row < stats_y)
+        slot.row = next_free_row++;
+
+    return slot;
+}
+
+// Estimated size of the sample on the wire, for the per-instance byte rates:
+// XCDR1 encapsulation header, key string (length, characters and terminator
+// padded to 4) and five 4-byte fields. The actual size depends on the type
+// and representation; the aggregate rate uses what the DataReader received.
+size_t estimated_serialized_size(const ShapeTypeExtended& shape) {
+
+    return 4 + 4 + ((shape.color().size() + 1 + 3) & ~(size_t) 3) + 5 * 4;
+}
+
+// Returns the slot index of an instance, creating the slot on first sight.
+// Must be called with table_mutex held.
+size_t find_slot(const dds::core::InstanceHandle& handle, const ShapeTypeExtended& shape) {
+
+    auto it = instance_index.find(handle);
+    if (it == instance_index.end()) {
+        it = instance_index.emplace(handle, instance_slots.size()).first;
+        instance_slots.push_back(make_slot(shape));
+        instance_latency.emplace_back(new LatencyHistogram<5>());
+    }
+    return it->second;
+}
+
+void store_sample(const dds::core::InstanceHandle& handle, const ShapeTypeExtended& shape, int64_t latency_us) {
+
+    std::lock_guard<std::mutex> lock(table_mutex);
+
+    size_t index = find_slot(handle, shape);
+    InstanceSlot& slot = instance_slots[index];
+    slot.shape = shape;
+    slot.samples++;
+    slot.bytes += estimated_serialized_size(shape);
+    instance_latency[index]->record(latency_us);
+    total_latency.record(latency_us);
+    if (!slot.dirty && slot.row >= 0) {
+        slot.dirty = true;
+        dirty_slots.push_back(index);
+    }
+}
+
+// Counts a state change of an instance that already has a slot and copies
+// its key from the slot into key_shape. Returns false, counting nothing, for
+// an instance without one.
+bool record_known_state_change(const dds::core::InstanceHandle& handle, ShapeTypeExtended& key_shape) {
+
+    std::lock_guard<std::mutex> lock(table_mutex);
+    auto it = instance_index.find(handle);
+    if (it == instance_index.end())
+        return false;
+    InstanceSlot& slot = instance_slots[it->second];
+    slot.state_changes++;
+    key_shape.color(slot.shape.color());
+    return true;
+}
+
+void record_state_change(const dds::core::InstanceHandle& handle, const ShapeTypeExtended& key_shape) {
+
+    std::lock_guard<std::mutex> lock(table_mutex);
+    instance_slots[find_slot(handle, key_shape)].state_changes++;
+}
+
+template <unsigned int SubBucketBits>
+void set_latency(stats_report::Record& record, const LatencyHistogram<SubBucketBits>& latency) {
+
+    record.latency_p50_us = latency.percentile(50.0);
+    record.latency_p99_us = latency.percentile(99.0);
+    record.latency_p999_us = latency.percentile(99.9);
+    record.latency_max_us = latency.max();
+}
+
+// How often stats_loop checks stop while waiting for the next report
+static const std::chrono::milliseconds stats_stop_poll(100);
+
+// Headless replacement for the render loop: every period seconds prints one
+// line per instance and one aggregate line with the rates since the previous
+// report, until stop is set. Latency percentiles are also since the previous
+// report for instances, and since the start for the aggregate. A last report
+// is printed on the way out, unless the previous one has just been printed.
+//
+// received_bytes returns the serialized bytes the DataReader has received,
+// from its protocol status, for the aggregate byte rate.
+void stats_loop(
+    double period,
+    stats_report::Format format,
+    std::function<unsigned long long()> received_bytes,
+    const std::atomic<bool>& stop) {
+
+    struct Totals {
+        unsigned long long samples = 0;
+        unsigned long long bytes = 0;
+        unsigned long long state_changes = 0;
+    };
+
+    struct InstanceReport {
+        string key;
+        Totals totals;
+        stats_report::Record record;
+    };
+
+    typedef std::chrono::steady_clock clock;
+    const clock::duration period_duration =
+        std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(period));
+    auto start = clock::now();
+    auto last = start;
+    auto next_report = start + period_duration;
+    std::vector<Totals> previous;
+    std::vector<InstanceReport> current;
+    // Empty histograms to exchange for those of the instances
+    std::vector<std::unique_ptr<LatencyHistogram<5>>> latency;
+    LatencyHistogram<> aggregate_latency;
+    stats_report::Record aggregate_record = {};
+    unsigned long long previous_allocations = allocation_counter::allocations();
+    unsigned long long previous_bytes = received_bytes();
+
+    stats_report::print_header(format, stdout);
+
+    bool last_report = false;
+    while (!last_report) {
+        // Waits in short slices so that a long period does not hold up the
+        // shutdown
+        auto now = clock::now();
+        while (!stop && now < next_report) {
+            std::this_thread::sleep_for(std::min<clock::duration>(stats_stop_poll, next_report - now));
+            now = clock::now();
+        }
+        next_report += period_duration;
+        if (stop) {
+            last_report = true;
+            // Rates over the last few milliseconds would only be noise
+            if (std::chrono::duration<double>(now - last).count() < std::min(0.1, period / 10))
+                break;
+        }
+
+        // Histograms for the instances that have appeared since the last
+        // report are allocated before taking the lock
+        size_t instance_count;
+        {
+            std::lock_guard<std::mutex> lock(table_mutex);
+            instance_count = instance_slots.size();
+        }
+        while (latency.size() < instance_count)
+            latency.emplace_back(new LatencyHistogram<5>());
+
+        // Only copy counters and swap histograms while holding the lock, the
+        // percentiles are computed once the reader thread can store samples
+        // again. An instance newer than the allocation above keeps its
+        // histogram until the next report.
+        {
+            std::lock_guard<std::mutex> lock(table_mutex);
+            current.resize(instance_slots.size());
+            for (size_t i = 0; i < instance_slots.size(); ++i) {
+                const InstanceSlot& slot = instance_slots[i];
+                current[i].key = slot.shape.color();
+                current[i].totals.samples = slot.samples;
+                current[i].totals.bytes = slot.bytes;
+                current[i].totals.state_changes = slot.state_changes;
+                if (i < latency.size())
+                    latency[i].swap(instance_latency[i]);
+            }
+            aggregate_latency = total_latency;
+        }
+        for (size_t i = 0; i < current.size(); ++i) {
+            if (i < latency.size()) {
+                set_latency(current[i].record, *latency[i]);
+                // Emptied for the next exchange
+                if (latency[i]->count() > 0)
+                    latency[i]->reset();
+            } else {
+                current[i].record.latency_p50_us = 0;
+                current[i].record.latency_p99_us = 0;
+                current[i].record.latency_p999_us = 0;
+                current[i].record.latency_max_us = 0;
+            }
+        }
+        set_latency(aggregate_record, aggregate_latency);
+        previous.resize(current.size());
+
+        now = clock::now();
+        double elapsed = std::chrono::duration<double>(now - last).count();
+        double time = std::chrono::duration<double>(now - start).count();
+        last = now;
+
+        Totals aggregate;
+        for (size_t i = 0; i < current.size(); ++i) {
+            const Totals& totals = current[i].totals;
+            Totals delta;
+            delta.samples = totals.samples - previous[i].samples;
+            delta.bytes = totals.bytes - previous[i].bytes;
+            delta.state_changes = totals.state_changes - previous[i].state_changes;
+
+            stats_report::Record& record = current[i].record;
+            record.type = "instance";
+            record.time = time;
+            record.key = current[i].key.c_str();
+            record.samples_per_second = delta.samples / elapsed;
+            record.bytes_per_second = delta.bytes / elapsed;
+            record.instances = 1;
+            record.state_changes = delta.state_changes;
+            record.heap_allocs_per_second = 0.0;
+            stats_report::print(format, record, stdout);
+
+            aggregate.samples += delta.samples;
+            aggregate.state_changes += delta.state_changes;
+            previous[i] = totals;
+        }
+
+        aggregate_record.type = "aggregate";
+        aggregate_record.time = time;
+        aggregate_record.key = "";
+        aggregate_record.samples_per_second = aggregate.samples / elapsed;
+        unsigned long long bytes = received_bytes();
+        aggregate_record.bytes_per_second = (bytes - previous_bytes) / elapsed;
+        previous_bytes = bytes;
+        aggregate_record.instances = current.size();
+        aggregate_record.state_changes = aggregate.state_changes;
+
+        // Operator new calls of the whole process since the last report,
+        // this thread's included; zero once the reader has warmed up
+        unsigned long long allocations = allocation_counter::allocations();
+        aggregate_record.heap_allocs_per_second = (allocations - previous_allocations) / elapsed;
+        previous_allocations = allocations;
+        stats_report::print(format, aggregate_record, stdout);
+        fflush(stdout);
+    }
+}
+
+// Latency summary printed once ncurses has released the terminal
+void print_latency_summary() {
+
+    std::lock_guard<std::mutex> lock(table_mutex);
+
+    printf("Latency (us)           samples      p50      p99    p99.9      max\n");
+    printf("%-20s %9llu %8llu %8llu %8llu %8llu\n", "all instances",
+        (unsigned long long) total_latency.count(),
+        (unsigned long long) total_latency.percentile(50.0), (unsigned long long) total_latency.percentile(99.0),
+        (unsigned long long) total_latency.percentile(99.9), (unsigned long long) total_latency.max());
+    for (size_t i = 0; i < instance_slots.size(); ++i) {
+        const LatencyHistogram<5>& latency = *instance_latency[i];
+        printf("%-20s %9llu %8llu %8llu %8llu %8llu\n", instance_slots[i].shape.color().c_str(),
+            (unsigned long long) latency.count(),
+            (unsigned long long) latency.percentile(50.0), (unsigned long long) latency.percentile(99.0),
+            (unsigned long long) latency.percentile(99.9), (unsigned long long) latency.max());
+    }
+    if (total_latency.negative_count() > 0) {
+        printf("%llu samples had a source timestamp ahead of reception (clock skew)\n",
+            (unsigned long long) total_latency.negative_count());
+    }
+}
 
-            if (has_colors()) {
-                attron(COLOR_PAIR(c));
-                if (c == colours::YELLOW || c == colours::ORANGE)
-                    attron(A_BOLD);
+// Samples taken by the reader thread, read by the render thread to report
+// how many samples each refresh covers
+static std::atomic<unsigned long long> samples_taken(0);
+
+// Redraws the instances updated and the log lines posted since the previous
+// frame, frame_rate times per second, until stop is set. Everything is staged
+// first and flushed to the terminal with one refresh(), which is skipped when
+// nothing changed.
+void render_loop(double frame_rate, async_log::AsyncLog& log, const std::atomic<bool>& stop) {
+
+    pacing::Pacer pacer(frame_rate, std::chrono::nanoseconds(0));
+    std::vector<InstanceSlot> frame;
+
+    auto stats_start = std::chrono::steady_clock::now();
+    unsigned long long stats_samples = samples_taken;
+    unsigned int refreshes = 0;
+    LatencyHistogram<> latency;
+
+    while (!stop) {
+        {
+            std::lock_guard<std::mutex> lock(table_mutex);
+            for (size_t index : dirty_slots) {
+                frame.push_back(instance_slots[index]);
+                instance_slots[index].dirty = false;
             }
+            dirty_slots.clear();
+        }
 
-            mvaddstr(c, 0, shape.color().c_str());
-            if (has_colors()) {
-                attroff(COLOR_PAIR(c));
-                attroff(A_BOLD);
+        for (const auto& slot : frame)
+            display_sample(slot.row, slot.colour, slot.shape);
+        bool changed = !frame.empty();
+        frame.clear();
+
+        log.drain();
+        if (log_view.draw())
+            changed = true;
+
+        auto now = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed = now - stats_start;
+        if (elapsed.count() >= 1.0) {
+            unsigned long long samples = samples_taken;
+            {
+                std::lock_guard<std::mutex> lock(table_mutex);
+                latency = total_latency;
             }
-            
-            stringstream ss;
-            ss << shape;
-            mvaddstr(c, 10, ss.str().c_str());
-            refresh();
+            display_stats(
+                refreshes / elapsed.count(),
+                refreshes > 0 ? (double) (samples - stats_samples) / refreshes : 0.0,
+                latency);
+            stats_start = now;
+            stats_samples = samples;
+            refreshes = 0;
+            changed = true;
+        }
 
-            break;
+        if (changed) {
+            refresh();
+            ++refreshes;
         }
+
+        pacer.wait();
     }
+
+    log.drain();
+    if (log_view.draw())
+        refresh();
 }
 
-int process_data(dds::sub::DataReader< ::ShapeTypeExtended> reader)
+// A zero-copy sample is read in place from the writer's shared memory, which
+// the writer may already be reusing for a newer sample
+template <typename T>
+bool is_consistent(dds::sub::DataReader<T>&, const rti::sub::LoanedSample<T>&)
 {
-    stringstream ss;
-    // Take all samples
+    return true;
+}
+
+bool is_consistent(
+    dds::sub::DataReader< ::ShapeTypeZeroCopy>& reader,
+    const rti::sub::LoanedSample< ::ShapeTypeZeroCopy>& sample)
+{
+    return reader->is_data_consistent(sample);
+}
+
+// Key of an instance without a slot, e.g. one disposed before this reader
+// received any of its data, asked from the DataReader
+void instance_key(
+    dds::sub::DataReader< ::ShapeTypeExtended>& reader,
+    const dds::core::InstanceHandle& handle,
+    ShapeTypeExtended& key_shape)
+{
+    reader.key_value(key_shape, handle);
+}
+
+template <typename T>
+void instance_key(
+    dds::sub::DataReader<T>& reader,
+    const dds::core::InstanceHandle& handle,
+    ShapeTypeExtended& key_shape)
+{
+    T key_holder;
+    reader.key_value(key_holder, handle);
+    key_shape.color(shape_types::key(key_holder));
+}
+
+// FlatData samples only exist in the reader's buffers, so there is nothing
+// key_value() could fill
+void instance_key(
+    dds::sub::DataReader< ::ShapeTypeExtendedFlat>&,
+    const dds::core::InstanceHandle&,
+    ShapeTypeExtended& key_shape)
+{
+    key_shape.color("unknown");
+}
+
+// key_value() would only fill the id, the colour is not part of the key
+void instance_key(
+    dds::sub::DataReader< ::ShapeTypeCompactKey>&,
+    const dds::core::InstanceHandle&,
+    ShapeTypeExtended& key_shape)
+{
+    key_shape.color("unknown");
+}
+
+// For the state change log lines, which are formatted without streams
+const char *instance_state_name(const dds::sub::status::InstanceState& state)
+{
+    if (state == dds::sub::status::InstanceState::alive())
+        return "ALIVE";
+    if (state == dds::sub::status::InstanceState::not_alive_disposed())
+        return "NOT_ALIVE_DISPOSED";
+    if (state == dds::sub::status::InstanceState::not_alive_no_writers())
+        return "NOT_ALIVE_NO_WRITERS";
+    return "UNKNOWN";
+}
+
+template <typename T>
+int process_data(
+    dds::sub::DataReader<T>& reader,
+    const dds::sub::LoanedSamples<T>& samples,
+    async_log::AsyncLog& log)
+{
+    // The table stores ShapeTypeExtended, other types are converted here
+    static ShapeTypeExtended scratch;
     int count = 0;
-    dds::sub::LoanedSamples< ::ShapeTypeExtended> samples = reader.take();
-    for (auto sample : samples) {
+    // Samples and their info are read in place from the loan
+    for (const auto& sample : samples) {
         if (sample.info().valid()) {                                     
+            // Copied out first: a zero-copy sample is only known to be
+            // intact if it is still consistent after it has been read
+            const ShapeTypeExtended& shape = shape_types::to_extended(sample.data(), scratch);
+            if (!is_consistent(reader, sample))
+                continue;
             count++;
-            display_sample(sample.data());
+
+            // Latency from the write on the publisher side to the arrival
+            // here, using the writer's source timestamp
+            int64_t latency_us = (int64_t) sample.info()->reception_timestamp().to_microsecs()
+                - (int64_t) sample.info().source_timestamp().to_microsecs();
+            store_sample(sample.info().instance_handle(), shape, latency_us);
             //std::cout << sample.data() << std::endl;            
         } 
         else {
-            ss.str("");
-            ShapeTypeExtended key_shape;
-            reader.key_value(key_shape, sample.info().instance_handle());
+            // From the pool the plugin also uses, so its colour string is
+            // already grown after the first few state changes
+            sample_pool::Pooled<ShapeTypeExtended> pooled = sample_pool::acquire<ShapeTypeExtended>();
+            ShapeTypeExtended& key_shape = *pooled;
+            const dds::core::InstanceHandle& handle = sample.info().instance_handle();
+            // The slot of the instance has its key, the DataReader is only
+            // asked for instances no valid sample has been received of
+            if (!record_known_state_change(handle, key_shape)) {
+                instance_key(reader, handle, key_shape);
+                record_state_change(handle, key_shape);
+            }
 
             if (dds::sub::status::InstanceState::not_alive_no_writers() == sample.info().state().instance_state() &&
                 dds::sub::status::SampleState::not_read() == sample.info().state().sample_state()) {
 
-                ss << "Instance with key " << key_shape.color() << " has dropped from the databus";
-                display_log(ss.str());
+                log.log("Instance with key %s has dropped from the databus", key_shape.color().c_str());
             }
             else {
                 // Announce other instance state changes
-                ss << "Instance with key " << key_shape.color() << " changed to " << 
-                    sample.info().state().instance_state();
-                display_log(ss.str());
+                log.log("Instance with key %s changed to %s", key_shape.color().c_str(),
+                    instance_state_name(sample.info().state().instance_state()));
             }
         }
     }
 
+    samples_taken += count;
     return count; 
+}
+
+// Takes all samples
+template <typename T>
+int take_all(dds::sub::DataReader<T> reader, async_log::AsyncLog& log)
+{
+    return process_data(reader, reader.take(), log);
 } // The LoanedSamples destructor returns the loan
 
-void run_subscriber_application(unsigned int domain_id, unsigned int sample_count)
+// Takes at most per_instance samples from each instance in turn, starting
+// after the instance served last (cursor), until per_dispatch samples have
+// been taken or the last instance is reached. What is left keeps the
+// ReadCondition triggered, so the WaitSet calls back right away: one busy
+// instance can neither hold up the others nor keep the loop in the handler
+// for longer than per_dispatch samples take.
+template <typename T>
+int drain_instances(
+    dds::sub::DataReader<T> reader,
+    unsigned int per_instance,
+    unsigned int per_dispatch,
+    dds::core::InstanceHandle& cursor,
+    async_log::AsyncLog& log)
 {
-    // DDS objects behave like shared pointers or value types
-    // (see https://community.rti.com/best-practices/use-modern-c-types-correctly)
+    int count = 0;
+    unsigned int taken = 0;
+    while (per_dispatch == 0 || taken < per_dispatch) {
+        unsigned int max_samples = per_instance;
+        if (per_dispatch > 0 && per_dispatch - taken < max_samples)
+            max_samples = per_dispatch - taken;
+
+        dds::sub::LoanedSamples<T> samples;
+        try {
+            samples = reader.select().next_instance(cursor).max_samples((int32_t) max_samples).take();
+        } catch (const dds::core::InvalidArgumentError&) {
+            // The cursor's instance has been purged since, start over. From
+            // the first instance the error has another cause, so it is not
+            // retried
+            if (cursor.is_nil())
+                throw;
+            cursor = dds::core::InstanceHandle::nil();
+            continue;
+        }
 
-    // Start communicating in a domain, usually one participant per application
-    dds::domain::DomainParticipant participant(domain_id);
+        if (samples.length() == 0) {
+            // Past the last instance, the next dispatch starts from the first
+            cursor = dds::core::InstanceHandle::nil();
+            break;
+        }
+        cursor = samples[0].info().instance_handle();
+        taken += samples.length();
+        count += process_data(reader, samples, log);
+    }
+    return count;
+}
 
+// Takes samples of type T until the sample count is reached or ctrl-c, while
+// the render (or statistics) thread shows them
+template <typename T>
+void subscribe(
+    dds::domain::DomainParticipant& participant,
+    dds::sub::Subscriber& subscriber,
+    const dds::sub::qos::DataReaderQos& reader_qos,
+    const application::ApplicationArguments& arguments,
+    async_log::AsyncLog& log)
+{
     // Create a Topic with a name and a datatype
-    dds::topic::Topic< ::ShapeTypeExtended> topic(participant, "Square");
+    dds::topic::Topic<T> topic(participant, shape_types::Traits<T>::topic_name());
 
-    // Create a Subscriber and DataReader with default Qos
-    dds::sub::Subscriber subscriber(participant);
-    dds::sub::DataReader< ::ShapeTypeExtended> reader(subscriber, topic);
+    // Create a DataReader, on a ContentFilteredTopic with --filter
+    dds::sub::DataReader<T> reader = content_filter::create_reader(subscriber, topic, reader_qos, arguments.filter);
 
     // Create a ReadCondition for any data received on this reader and set a
     // handler to process the data
     unsigned int samples_read = 0;
+    dds::core::InstanceHandle cursor = dds::core::InstanceHandle::nil();
+    const unsigned int per_instance = arguments.drain_per_instance;
+    const unsigned int per_dispatch = arguments.drain_per_dispatch;
     dds::sub::cond::ReadCondition read_condition(
         reader,
         dds::sub::status::DataState::any(),
-        [reader, &samples_read]() { samples_read += process_data(reader); });
+        [reader, per_instance, per_dispatch, &cursor, &samples_read, &log]() {
+            if (per_instance == 0)
+                samples_read += take_all(reader, log);
+            else
+                samples_read += drain_instances(reader, per_instance, per_dispatch, cursor, log);
+        });
 
     // WaitSet will be woken when the attached condition is triggered
     dds::core::cond::WaitSet waitset;
     waitset += read_condition;
 
-    while (!application::shutdown_requested && samples_read < sample_count) {
-        //display_log("ShapeTypeExtended subscriber sleeping up to 1 sec...");
+    // This thread only takes samples, drawing (or printing statistics when
+    // headless) happens at a fixed rate in its own thread
+    std::atomic<bool> stop_render(false);
+    std::thread render_thread;
+    if (arguments.headless) {
+        std::function<unsigned long long()> received_bytes = [reader]() {
+            return (unsigned long long) reader->datareader_protocol_status().received_sample_bytes();
+        };
+        render_thread = std::thread(
+            stats_loop, arguments.stats_period, arguments.stats_format, received_bytes, std::cref(stop_render));
+    } else {
+        render_thread = std::thread(render_loop, arguments.frame_rate, std::ref(log), std::cref(stop_render));
+    }
+
+    try {
+        while (!application::shutdown_requested && samples_read < arguments.sample_count) {
+            //display_log("ShapeTypeExtended subscriber sleeping up to 1 sec...");
 
-        // Run the handlers of the active conditions. Wait for up to 1 second.
-        waitset.dispatch(dds::core::Duration(1));
+            // Run the handlers of the active conditions. Wait for up to 1 second.
+            waitset.dispatch(dds::core::Duration(1));
+        }
+    } catch (...) {
+        stop_render = true;
+        render_thread.join();
+        throw;
     }
+
+    stop_render = true;
+    render_thread.join();
 }
 
-int main(int argc, char *argv[])
+void run_subscriber_application(const application::ApplicationArguments& arguments, async_log::AsyncLog& log)
 {
+    // DDS objects behave like shared pointers or value types
+    // (see https://community.rti.com/best-practices/use-modern-c-types-correctly)
 
-    using namespace application;
+    // Every entity takes its QoS from the requested profile, or from the
+    // default profile in USER_QOS_PROFILES.xml when none is given
+    dds::core::QosProvider qos_provider = dds::core::QosProvider::Default();
+    const std::string qos_profile =
+        arguments.state && arguments.qos_profile.empty() ? STATE_PROFILE : arguments.qos_profile;
+    const bool use_default = qos_profile.empty();
 
-    initscr();
-    cbreak();
-    noecho();
+    // Start communicating in a domain, usually one participant per application
+    dds::domain::DomainParticipant participant(
+        arguments.domain_id,
+        use_default ? qos_provider.participant_qos() : qos_provider.participant_qos(qos_profile));
 
-    if (has_colors()) {
-        start_color();
-        init_color(COLOR_PURPLE, 128, 0, 128);
-        init_color(COLOR_ORANGE, 255, 165, 0);
+    // Create a Subscriber
+    dds::sub::Subscriber subscriber(participant);
 
-        init_pair(colours::PURPLE, COLOR_PURPLE, COLOR_BLACK);
-        init_pair(colours::BLUE, COLOR_BLUE, COLOR_BLACK);
-        init_pair(colours::RED, COLOR_RED, COLOR_BLACK);
-        init_pair(colours::GREEN, COLOR_GREEN, COLOR_BLACK);
-        init_pair(colours::YELLOW, COLOR_YELLOW, COLOR_BLACK);
-        init_pair(colours::CYAN, COLOR_CYAN, COLOR_BLACK);
-        init_pair(colours::MAGENTA, COLOR_MAGENTA, COLOR_BLACK);
-        init_pair(colours::ORANGE, COLOR_ORANGE, COLOR_BLACK);
+    // The Topic and DataReader are created for the requested data type
+    dds::sub::qos::DataReaderQos reader_qos =
+        use_default ? qos_provider.datareader_qos() : qos_provider.datareader_qos(qos_profile);
+    data_representation::apply(reader_qos, arguments.data_representation);
+
+    // The table only shows the newest sample of each instance anyway. With
+    // a depth of 1 a newer sample replaces the one not taken yet in the
+    // reader queue, so a slow subscriber falls behind by at most one sample
+    // per instance and never holds up a reliable writer
+    if (arguments.state)
+        reader_qos << dds::core::policy::History::KeepLast(1);
+
+    if (arguments.data_type == "extended") {
+        subscribe< ::ShapeTypeExtended>(participant, subscriber, reader_qos, arguments, log);
+    } else if (arguments.data_type == "zero_copy") {
+        subscribe< ::ShapeTypeZeroCopy>(participant, subscriber, reader_qos, arguments, log);
+    } else if (arguments.data_type == "flat_data") {
+        subscribe< ::ShapeTypeExtendedFlat>(participant, subscriber, reader_qos, arguments, log);
+    } else if (arguments.data_type == "compact_key") {
+        subscribe< ::ShapeTypeCompactKey>(participant, subscriber, reader_qos, arguments, log);
+    } else {
+        throw std::invalid_argument("unknown data type " + arguments.data_type);
     }
+}
 
-    clear();
+int main(int argc, char *argv[])
+{
+
+    using namespace application;
 
     // Parse arguments and handle control-C
     auto arguments = parse_arguments(argc, argv);
@@ -193,10 +869,53 @@ int main(int argc, char *argv[])
     // Sets Connext verbosity to help debugging
     rti::config::Logger::instance().verbosity(arguments.verbosity);
 
+    // Headless mode never touches the terminal: statistics go to stdout and
+    // instance state changes to stderr from the log's own thread
+    std::unique_ptr<async_log::AsyncLog> log;
+    if (arguments.headless) {
+        log.reset(new async_log::AsyncLog(
+            256,
+            [](const char *line) { fprintf(stderr, "%s\n", line); }));
+    } else {
+        initscr();
+        cbreak();
+        noecho();
+
+        if (has_colors()) {
+            start_color();
+            init_color(COLOR_PURPLE, 128, 0, 128);
+            init_color(COLOR_ORANGE, 255, 165, 0);
+
+            init_pair(colours::PURPLE, COLOR_PURPLE, COLOR_BLACK);
+            init_pair(colours::BLUE, COLOR_BLUE, COLOR_BLACK);
+            init_pair(colours::RED, COLOR_RED, COLOR_BLACK);
+            init_pair(colours::GREEN, COLOR_GREEN, COLOR_BLACK);
+            init_pair(colours::YELLOW, COLOR_YELLOW, COLOR_BLACK);
+            init_pair(colours::CYAN, COLOR_CYAN, COLOR_BLACK);
+            init_pair(colours::MAGENTA, COLOR_MAGENTA, COLOR_BLACK);
+            init_pair(colours::ORANGE, COLOR_ORANGE, COLOR_BLACK);
+        }
+
+        clear();
+
+        log_view.init(log_y, arguments.log_depth);
+
+        // Instance state changes go to the log area, drained by the render
+        // thread so it stays the only one drawing
+        log.reset(new async_log::AsyncLog(
+            256,
+            [](const char *line) { display_log(line); },
+            async_log::AsyncLog::Flush(),
+            1,
+            false));
+    }
+
     try {
-        run_subscriber_application(arguments.domain_id, arguments.sample_count);
+        run_subscriber_application(arguments, *log);
     } catch (const std::exception& ex) {
         // This will catch DDS exceptions
+        if (!arguments.headless)
+            endwin();
         std::cerr << "Exception in run_subscriber_application(): " << ex.what()
         << std::endl;
         return EXIT_FAILURE;
@@ -206,7 +925,19 @@ int main(int argc, char *argv[])
     // application exit
     dds::domain::DomainParticipant::finalize_participant_factory();
 
-    endwin();
+    log->stop();
+    if (!arguments.headless) {
+        endwin();
+        print_latency_summary();
+    }
+
+    if (log->dropped() > 0) {
+        std::cerr << "Log lines written: " << log->logged() << ", dropped: " << log->dropped() << endl;
+    }
+
+    sample_pool::Pool<ShapeTypeExtended>& pool = sample_pool::Pool<ShapeTypeExtended>::instance();
+    std::cerr << "ShapeTypeExtended samples allocated: " << pool.allocated() << ", reused: " << pool.reused()
+        << "; heap allocations: " << allocation_counter::allocations() << endl;
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,354 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+// Throughput benchmark for keyed shape samples.
+//
+// The pub side writes round-robin over -i instances of the --data-type
+// (ShapeTypeExtended on "Square" by default) as fast as it can (or at -r
+// samples/s). The sub side counts the samples it receives, the samples it
+// lost (gaps in the publication sequence numbers of each writer) and both
+// sides report their CPU use, once per second and when done. The QoS comes
+// from -q, e.g.:
+//
+//    shapes_throughput --role sub -q shapes_Library::throughput_best_effort
+//    shapes_throughput --role pub -q shapes_Library::throughput_best_effort -i 1000 -s 1000000
+//
+// With --write-with-handle the pub side registers every instance up front
+// and writes with the cached handle, so comparing both modes at high
+// instance counts shows what hashing the key on every write costs.
+//
+// Comparing --data-type extended, zero_copy and flat_data shows what the
+// plain C++ binding's serialization and copies cost; extended against
+// compact_key what the MD5 key hash of the string<128> key costs.
+//
+// --data-representation xcdr or xcdr2 sets the encoding on both sides. The
+// total lines report the serialized bytes per sample from the protocol
+// statuses next to the CPU per sample, so the two encodings can be compared
+// in size and (de)serialization cost.
+//
+// --filter on the sub side reads through a ContentFilteredTopic; the pub
+// total line then shows how many samples and bytes the DataWriter filtered
+// out instead of sending.
+//
+// run_throughput_sweep.sh runs both sides over a range of instance counts,
+// profiles, write modes and representations.
+
+#include <sys/resource.h>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <dds/pub/ddspub.hpp>
+#include <dds/sub/ddssub.hpp>
+#include <dds/core/ddscore.hpp>
+#include <rti/util/util.hpp>      // for sleep()
+#include <rti/config/Logger.hpp>  // for logging
+
+#include "application.hpp"  // for command line parsing and ctrl-c
+#include "shapes.hpp"
+#include "pacing.hpp"
+#include "instance_handle_hash.hpp"
+#include "shape_writers.hpp"
+#include "data_representation.hpp"
+#include "content_filter.hpp"
+
+const char *DEFAULT_PROFILE = "shapes_Library::throughput_reliable";
+
+// Process CPU time (user + system) against wall-clock time, in percent of
+// one core, over the interval since the last call
+class CpuMeter {
+  public:
+    CpuMeter() : start_cpu_(cpu_seconds()), last_cpu_(start_cpu_), last_wall_(clock::now()) {}
+
+    // CPU seconds used since the meter was created
+    double seconds() const { return cpu_seconds() - start_cpu_; }
+
+    double percent()
+    {
+        double cpu = cpu_seconds();
+        clock::time_point wall = clock::now();
+        std::chrono::duration<double> elapsed = wall - last_wall_;
+        double result = elapsed.count() > 0 ? 100.0 * (cpu - last_cpu_) / elapsed.count() : 0.0;
+        last_cpu_ = cpu;
+        last_wall_ = wall;
+        return result;
+    }
+
+  private:
+    typedef std::chrono::steady_clock clock;
+
+    static double cpu_seconds()
+    {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec
+            + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+    }
+
+    double start_cpu_;
+    double last_cpu_;
+    clock::time_point last_wall_;
+};
+
+template <typename ShapeWriter>
+void run_pub(
+    dds::domain::DomainParticipant& participant,
+    const std::string& profile,
+    const application::ApplicationArguments& arguments)
+{
+    typedef std::chrono::steady_clock clock;
+
+    std::vector<std::string> keys;
+    for (unsigned int i = 0; i < arguments.instance_count; ++i)
+        keys.push_back(colours::instance_key(arguments.color, i));
+
+    // Samples (or, for the loaning types, keys) are prepared and instances
+    // registered before the measured loop
+    dds::pub::Publisher publisher(participant);
+    dds::pub::qos::DataWriterQos writer_qos = dds::core::QosProvider::Default().datawriter_qos(profile);
+    data_representation::apply(writer_qos, arguments.data_representation);
+    content_filter::enable_writer_filtering(writer_qos);
+    clock::time_point setup_start = clock::now();
+    ShapeWriter writer(
+        participant,
+        publisher,
+        writer_qos,
+        keys,
+        30,
+        arguments.write_with_handle);
+    if (arguments.write_with_handle) {
+        std::chrono::duration<double, std::milli> register_time = clock::now() - setup_start;
+        printf("pub: registered %zu instances in %.1f ms\n", keys.size(), register_time.count());
+    }
+
+    std::cout << "Waiting for a subscriber..." << std::endl;
+    while (!application::shutdown_requested
+            && writer.data_writer().publication_matched_status().current_count() == 0) {
+        rti::util::sleep(dds::core::Duration::from_millisecs(100));
+    }
+
+    // Unlike the publisher, no rate means as fast as possible
+    pacing::Pacer pacer(arguments.rate < 0 ? 0.0 : arguments.rate);
+    CpuMeter interval_cpu, total_cpu;
+    clock::time_point start = clock::now();
+    clock::time_point next_report = start + std::chrono::seconds(1);
+    unsigned long long written = 0, written_at_report = 0;
+
+    while (!application::shutdown_requested && written < arguments.sample_count) {
+        pacer.wait();
+
+        unsigned int index = (unsigned int) (written % arguments.instance_count);
+        writer.write(index, (int32_t) written, 0);
+        ++written;
+
+        // A frame is one round over all the instances
+        if (arguments.flush_per_frame && index == arguments.instance_count - 1)
+            writer.flush();
+
+        // Checking the clock every sample would show up in the unthrottled
+        // measurement
+        if ((pacer.requested_rate() > 0 || (written & 0x3ff) == 0) && clock::now() >= next_report) {
+            printf("pub: %10llu samples/s, cpu %5.1f%%\n", written - written_at_report, interval_cpu.percent());
+            fflush(stdout);
+            written_at_report = written;
+            next_report += std::chrono::seconds(1);
+        }
+    }
+
+    std::chrono::duration<double> elapsed = clock::now() - start;
+    writer.data_writer().wait_for_acknowledgments(dds::core::Duration(10));
+
+    // CPU per sample is what tells the bindings and key types apart when
+    // the rate is bounded by the other side
+    double cpu_us_per_sample = written > 0 ? total_cpu.seconds() * 1e6 / written : 0.0;
+    rti::core::status::DataWriterProtocolStatus protocol = writer.data_writer()->datawriter_protocol_status();
+    double bytes_per_sample = protocol.pushed_sample_count() > 0
+        ? (double) protocol.pushed_sample_bytes() / protocol.pushed_sample_count() : 0.0;
+    printf("pub total: %llu %s samples (%s) over %u instances (%s) in %.2f s, %.0f samples/s, cpu %.1f%%, "
+        "%.2f us cpu/sample, %.1f bytes/sample\n",
+        written, arguments.data_type.c_str(), data_representation::label(arguments.data_representation),
+        arguments.instance_count, arguments.write_with_handle ? "by handle" : "by key", elapsed.count(),
+        elapsed.count() > 0 ? written / elapsed.count() : 0.0, total_cpu.percent(), cpu_us_per_sample,
+        bytes_per_sample);
+    printf("pub total traffic: %llu samples (%llu bytes) sent, %llu samples (%llu bytes) filtered out by the writer\n",
+        (unsigned long long) protocol.pushed_sample_count(), (unsigned long long) protocol.pushed_sample_bytes(),
+        (unsigned long long) protocol.filtered_sample_count(), (unsigned long long) protocol.filtered_sample_bytes());
+}
+
+template <typename T>
+void run_sub(
+    dds::domain::DomainParticipant& participant,
+    const std::string& profile,
+    const std::string& representation,
+    const std::string& filter)
+{
+    typedef std::chrono::steady_clock clock;
+
+    dds::topic::Topic<T> topic(participant, shape_types::Traits<T>::topic_name());
+    dds::sub::Subscriber subscriber(participant);
+    dds::sub::qos::DataReaderQos reader_qos = dds::core::QosProvider::Default().datareader_qos(profile);
+    data_representation::apply(reader_qos, representation);
+    dds::sub::DataReader<T> reader = content_filter::create_reader(subscriber, topic, reader_qos, filter);
+
+    // Last sequence number seen from each matched DataWriter. Samples a
+    // filter rejects leave gaps in the sequence too, so there is no loss
+    // count with --filter.
+    std::unordered_map<dds::core::InstanceHandle, int64_t, InstanceHandleHash> last_sequence;
+    unsigned long long received = 0, lost = 0;
+    const bool count_lost = filter.empty();
+
+    // Takes what the reader has and returns how many samples that was
+    auto take_samples = [&]() {
+        dds::sub::LoanedSamples<T> samples = reader.take();
+        for (const auto& sample : samples) {
+            if (!sample.info().valid())
+                continue;
+            ++received;
+            if (!count_lost)
+                continue;
+
+            int64_t sequence = sample.info()->publication_sequence_number().value();
+            auto found = last_sequence.find(sample.info().publication_handle());
+            if (found == last_sequence.end()) {
+                last_sequence.emplace(sample.info().publication_handle(), sequence);
+            } else {
+                if (sequence > found->second + 1)
+                    lost += sequence - found->second - 1;
+                found->second = sequence;
+            }
+        }
+        return samples.length();
+    };
+
+    dds::sub::cond::ReadCondition read_condition(
+        reader,
+        dds::sub::status::DataState::any(),
+        [&]() { take_samples(); });
+
+    dds::core::cond::WaitSet waitset;
+    waitset += read_condition;
+
+    std::cout << "Waiting for a publisher..." << std::endl;
+    while (!application::shutdown_requested
+            && reader.subscription_matched_status().current_count() == 0) {
+        waitset.dispatch(dds::core::Duration::from_millisecs(100));
+    }
+
+    CpuMeter interval_cpu, total_cpu;
+    clock::time_point start = clock::now();
+    clock::time_point next_report = start + std::chrono::seconds(1);
+    unsigned long long received_at_report = 0, lost_at_report = 0;
+
+    // Runs until the last publisher goes away
+    while (!application::shutdown_requested
+            && reader.subscription_matched_status().current_count() > 0) {
+        waitset.dispatch(dds::core::Duration::from_millisecs(100));
+
+        if (clock::now() >= next_report) {
+            printf("sub: %10llu samples/s, %8llu lost, cpu %5.1f%%\n",
+                received - received_at_report, lost - lost_at_report, interval_cpu.percent());
+            fflush(stdout);
+            received_at_report = received;
+            lost_at_report = lost;
+            next_report += std::chrono::seconds(1);
+        }
+    }
+
+    // Samples that arrived with the publisher's last ones may still be
+    // queued once it has unmatched
+    while (take_samples() > 0) {
+    }
+
+    std::chrono::duration<double> elapsed = clock::now() - start;
+    double cpu_us_per_sample = received > 0 ? total_cpu.seconds() * 1e6 / received : 0.0;
+    rti::core::status::DataReaderProtocolStatus protocol = reader->datareader_protocol_status();
+    double bytes_per_sample = protocol.received_sample_count() > 0
+        ? (double) protocol.received_sample_bytes() / protocol.received_sample_count() : 0.0;
+    printf("sub total: %llu samples (%s), %llu lost (%.3f%%) in %.2f s, %.0f samples/s, cpu %.1f%%, "
+        "%.2f us cpu/sample, %.1f bytes/sample\n",
+        received, data_representation::label(representation), lost,
+        received + lost > 0 ? 100.0 * lost / (received + lost) : 0.0,
+        elapsed.count(), elapsed.count() > 0 ? received / elapsed.count() : 0.0, total_cpu.percent(), cpu_us_per_sample,
+        bytes_per_sample);
+}
+
+// Runs the requested side with the types of the requested --data-type
+template <typename T, typename ShapeWriter>
+void run(
+    dds::domain::DomainParticipant& participant,
+    const std::string& profile,
+    const application::ApplicationArguments& arguments)
+{
+    if (arguments.role == "pub")
+        run_pub<ShapeWriter>(participant, profile, arguments);
+    else
+        run_sub<T>(participant, profile, arguments.data_representation, arguments.filter);
+}
+
+int main(int argc, char *argv[])
+{
+
+    using namespace application;
+
+    // Parse arguments and handle control-C
+    auto arguments = parse_arguments(argc, argv);
+    if (arguments.parse_result == ParseReturn::exit) {
+        return EXIT_SUCCESS;
+    } else if (arguments.parse_result == ParseReturn::failure) {
+        return EXIT_FAILURE;
+    }
+    setup_signal_handlers();
+
+    // Sets Connext verbosity to help debugging
+    rti::config::Logger::instance().verbosity(arguments.verbosity);
+
+    if (arguments.role.empty())
+        arguments.role = "pub";
+    if (arguments.role != "pub" && arguments.role != "sub") {
+        std::cerr << "Unknown role " << arguments.role << ", use pub or sub" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string profile = arguments.qos_profile.empty() ? DEFAULT_PROFILE : arguments.qos_profile;
+
+    try {
+        dds::domain::DomainParticipant participant(
+            arguments.domain_id,
+            dds::core::QosProvider::Default().participant_qos(profile));
+
+        if (arguments.data_type == "extended") {
+            run< ::ShapeTypeExtended, shape_writers::SampleWriter< ::ShapeTypeExtended>>(participant, profile, arguments);
+        } else if (arguments.data_type == "zero_copy") {
+            run< ::ShapeTypeZeroCopy, shape_writers::LoanedSampleWriter>(participant, profile, arguments);
+        } else if (arguments.data_type == "flat_data") {
+            run< ::ShapeTypeExtendedFlat, shape_writers::FlatSampleWriter>(participant, profile, arguments);
+        } else if (arguments.data_type == "compact_key") {
+            run< ::ShapeTypeCompactKey, shape_writers::SampleWriter< ::ShapeTypeCompactKey>>(participant, profile, arguments);
+        } else {
+            throw std::invalid_argument("unknown data type " + arguments.data_type);
+        }
+    } catch (const std::exception& ex) {
+        // This will catch DDS exceptions
+        std::cerr << "Exception in shapes_throughput: " << ex.what()
+        << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Releases the memory used by the participant factory.  Optional at
+    // application exit
+    dds::domain::DomainParticipant::finalize_participant_factory();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,481 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_zero_copy.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_zero_copy.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#include <iosfwd>
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#ifndef NDDS_STANDALONE_TYPE
+#include "rti/topic/cdr/Serialization.hpp"
+#include "shapes_zero_copyPlugin.hpp"
+#else
+#include "rti/topic/cdr/SerializationHelpers.hpp"
+#endif
+
+#include "shapes_zero_copy.hpp"
+
+#include <rti/util/ostream_operators.hpp>
+
+// ---- ShapeTypeZeroCopy:
+
+ShapeTypeZeroCopy::ShapeTypeZeroCopy() :
+    m_color_ () ,
+    m_x_ (0) ,
+    m_y_ (0) ,
+    m_shapesize_ (0) ,
+    m_fillKind_(ShapeFillKind::SOLID_FILL) ,
+    m_angle_ (0.0f)  {
+
+}
+
+ShapeTypeZeroCopy::ShapeTypeZeroCopy (const ::dds::core::array< char, 128L>& color_,int32_t x_,int32_t y_,int32_t shapesize_,const ::ShapeFillKind& fillKind_,float angle_):
+    m_color_(color_),
+    m_x_(x_),
+    m_y_(y_),
+    m_shapesize_(shapesize_),
+    m_fillKind_(fillKind_),
+    m_angle_(angle_) {
+}
+
+void ShapeTypeZeroCopy::swap(ShapeTypeZeroCopy& other_)  noexcept
+{
+    using std::swap;
+    swap(m_color_, other_.m_color_);
+    swap(m_x_, other_.m_x_);
+    swap(m_y_, other_.m_y_);
+    swap(m_shapesize_, other_.m_shapesize_);
+    swap(m_fillKind_, other_.m_fillKind_);
+    swap(m_angle_, other_.m_angle_);
+}
+
+bool ShapeTypeZeroCopy::operator == (const ShapeTypeZeroCopy& other_) const {
+    if (m_color_ != other_.m_color_) {
+        return false;
+    }
+    if (m_x_ != other_.m_x_) {
+        return false;
+    }
+    if (m_y_ != other_.m_y_) {
+        return false;
+    }
+    if (m_shapesize_ != other_.m_shapesize_) {
+        return false;
+    }
+    if (m_fillKind_ != other_.m_fillKind_) {
+        return false;
+    }
+    if (std::fabs(m_angle_ - other_.m_angle_) > std::numeric_limits< float>::epsilon()
+    && !(std::fabs(m_angle_ - other_.m_angle_) < (std::numeric_limits< float>::min)())) {
+        return false;
+    }
+    return true;
+}
+
+bool ShapeTypeZeroCopy::operator != (const ShapeTypeZeroCopy& other_) const {
+    return !this->operator ==(other_);
+}
+
+std::ostream& operator << (std::ostream& o,const ShapeTypeZeroCopy& sample)
+{
+    ::rti::util::StreamFlagSaver flag_saver (o);
+    o <<"[";
+    o << "color: " << sample.color ()<<", ";
+    o << "x: " << sample.x ()<<", ";
+    o << "y: " << sample.y ()<<", ";
+    o << "shapesize: " << sample.shapesize ()<<", ";
+    o << "fillKind: " << sample.fillKind ()<<", ";
+    o << "angle: " << std::setprecision(9) << sample.angle ();
+    o <<"]";
+    return o;
+}
+
+#ifndef NDDS_STANDALONE_TYPE
+// --- Type traits: -------------------------------------------------
+
+namespace rti {
+    namespace topic {
+
+        template<>
+        struct native_type_code< ::ShapeTypeZeroCopy > {
+            static DDS_TypeCode * get()
+            {
+                using namespace ::rti::topic::interpreter;
+
+                static RTIBool is_initialized = RTI_FALSE;
+
+                static DDS_TypeCode ShapeTypeZeroCopy_g_tc_color_array;
+
+                static DDS_TypeCode_Member ShapeTypeZeroCopy_g_tc_members[6]=
+                {
+
+                    {
+                        (char *)"color",/* Member name */
+                        {
+                            0,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_KEY_MEMBER , /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"x",/* Member name */
+                        {
+                            1,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"y",/* Member name */
+                        {
+                            2,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"shapesize",/* Member name */
+                        {
+                            3,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"fillKind",/* Member name */
+                        {
+                            4,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    },
+                    {
+                        (char *)"angle",/* Member name */
+                        {
+                            5,/* Representation ID */
+                            DDS_BOOLEAN_FALSE,/* Is a pointer? */
+                            -1, /* Bitfield bits */
+                            NULL/* Member type code is assigned later */
+                        },
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        RTI_CDR_REQUIRED_MEMBER, /* Is a key? */
+                        DDS_PUBLIC_MEMBER,/* Member visibility */
+                        1,
+                        NULL, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER
+                    }
+                };
+
+                static DDS_TypeCode ShapeTypeZeroCopy_g_tc =
+                {{
+                        DDS_TK_STRUCT| RTI_XCDR_TK_FLAGS_IS_FINAL, /* Kind */
+                        DDS_BOOLEAN_FALSE, /* Ignored */
+                        -1, /*Ignored*/
+                        (char *)"ShapeTypeZeroCopy", /* Name */
+                        NULL, /* Ignored */
+                        0, /* Ignored */
+                        0, /* Ignored */
+                        NULL, /* Ignored */
+                        6, /* Number of members */
+                        ShapeTypeZeroCopy_g_tc_members, /* Members */
+                        DDS_VM_NONE, /* Ignored */
+                        RTICdrTypeCodeAnnotations_INITIALIZER,
+                        DDS_BOOLEAN_TRUE, /* _isCopyable */
+                        NULL, /* _sampleAccessInfo: assigned later */
+                        NULL /* _typePlugin: assigned later */
+                    }}; /* Type code for ShapeTypeZeroCopy*/
+
+                if (is_initialized) {
+                    return &ShapeTypeZeroCopy_g_tc;
+                }
+
+                is_initialized = RTI_TRUE;
+
+                ShapeTypeZeroCopy_g_tc_color_array = initialize_array_typecode< ::dds::core::array< char, 128L> >(128L);
+
+                ShapeTypeZeroCopy_g_tc._data._annotations._allowedDataRepresentationMask = 5;
+
+                ShapeTypeZeroCopy_g_tc._data._annotations._transferMode = RTI_XCDR_SHMEM_REF_TRANSFER_MODE;
+
+                ShapeTypeZeroCopy_g_tc_members[0]._representation._typeCode = (RTICdrTypeCode *)& ShapeTypeZeroCopy_g_tc_color_array;
+                ShapeTypeZeroCopy_g_tc_members[1]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeZeroCopy_g_tc_members[2]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeZeroCopy_g_tc_members[3]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_long;
+                ShapeTypeZeroCopy_g_tc_members[4]._representation._typeCode = (RTICdrTypeCode *)&::rti::topic::dynamic_type< ::ShapeFillKind>::get().native();
+                ShapeTypeZeroCopy_g_tc_members[5]._representation._typeCode = (RTICdrTypeCode *)&DDS_g_tc_float;
+
+                ShapeTypeZeroCopy_g_tc_color_array._data._typeCode =(RTICdrTypeCode *)&DDS_g_tc_char;
+
+                /* Initialize the values for member annotations. */
+                ShapeTypeZeroCopy_g_tc_members[1]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[1]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeZeroCopy_g_tc_members[1]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[1]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeZeroCopy_g_tc_members[1]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[1]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeZeroCopy_g_tc_members[2]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[2]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeZeroCopy_g_tc_members[2]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[2]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeZeroCopy_g_tc_members[2]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[2]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeZeroCopy_g_tc_members[3]._annotations._defaultValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[3]._annotations._defaultValue._u.long_value = 0;
+                ShapeTypeZeroCopy_g_tc_members[3]._annotations._minValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[3]._annotations._minValue._u.long_value = RTIXCdrLong_MIN;
+                ShapeTypeZeroCopy_g_tc_members[3]._annotations._maxValue._d = RTI_XCDR_TK_LONG;
+                ShapeTypeZeroCopy_g_tc_members[3]._annotations._maxValue._u.long_value = RTIXCdrLong_MAX;
+                ShapeTypeZeroCopy_g_tc_members[4]._annotations._defaultValue._d = RTI_XCDR_TK_ENUM;
+                ShapeTypeZeroCopy_g_tc_members[4]._annotations._defaultValue._u.enumerated_value = 0;
+                ShapeTypeZeroCopy_g_tc_members[5]._annotations._defaultValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeZeroCopy_g_tc_members[5]._annotations._defaultValue._u.float_value = 0.0f;
+                ShapeTypeZeroCopy_g_tc_members[5]._annotations._minValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeZeroCopy_g_tc_members[5]._annotations._minValue._u.float_value = RTIXCdrFloat_MIN;
+                ShapeTypeZeroCopy_g_tc_members[5]._annotations._maxValue._d = RTI_XCDR_TK_FLOAT;
+                ShapeTypeZeroCopy_g_tc_members[5]._annotations._maxValue._u.float_value = RTIXCdrFloat_MAX;
+
+                ShapeTypeZeroCopy_g_tc._data._sampleAccessInfo = sample_access_info();
+                ShapeTypeZeroCopy_g_tc._data._typePlugin = type_plugin_info();
+
+                return &ShapeTypeZeroCopy_g_tc;
+            }
+
+            static RTIXCdrSampleAccessInfo * sample_access_info()
+            {
+                static RTIBool is_initialized = RTI_FALSE;
+
+                ::ShapeTypeZeroCopy *sample;
+
+                static RTIXCdrMemberAccessInfo ShapeTypeZeroCopy_g_memberAccessInfos[6] =
+                {RTIXCdrMemberAccessInfo_INITIALIZER};
+
+                static RTIXCdrSampleAccessInfo ShapeTypeZeroCopy_g_sampleAccessInfo =
+                RTIXCdrSampleAccessInfo_INITIALIZER;
+
+                if (is_initialized) {
+                    return (RTIXCdrSampleAccessInfo*) &ShapeTypeZeroCopy_g_sampleAccessInfo;
+                }
+
+                RTIXCdrHeap_allocateStruct(
+                    &sample,
+                    ::ShapeTypeZeroCopy);
+                if (sample == NULL) {
+                    return NULL;
+                }
+
+                ShapeTypeZeroCopy_g_memberAccessInfos[0].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->color() - (char *)sample);
+
+                ShapeTypeZeroCopy_g_memberAccessInfos[1].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->x() - (char *)sample);
+
+                ShapeTypeZeroCopy_g_memberAccessInfos[2].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->y() - (char *)sample);
+
+                ShapeTypeZeroCopy_g_memberAccessInfos[3].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->shapesize() - (char *)sample);
+
+                ShapeTypeZeroCopy_g_memberAccessInfos[4].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->fillKind() - (char *)sample);
+
+                ShapeTypeZeroCopy_g_memberAccessInfos[5].bindingMemberValueOffset[0] =
+                (RTIXCdrUnsignedLong) ((char *)&sample->angle() - (char *)sample);
+
+                ShapeTypeZeroCopy_g_sampleAccessInfo.memberAccessInfos =
+                ShapeTypeZeroCopy_g_memberAccessInfos;
+
+                {
+                    size_t candidateTypeSize = sizeof(::ShapeTypeZeroCopy);
+
+                    if (candidateTypeSize > RTIXCdrLong_MAX) {
+                        ShapeTypeZeroCopy_g_sampleAccessInfo.typeSize[0] =
+                        RTIXCdrLong_MAX;
+                    } else {
+                        ShapeTypeZeroCopy_g_sampleAccessInfo.typeSize[0] =
+                        (RTIXCdrUnsignedLong) candidateTypeSize;
+                    }
+                }
+
+                ShapeTypeZeroCopy_g_sampleAccessInfo.useGetMemberValueOnlyWithRef =
+                RTI_XCDR_TRUE;
+
+                ShapeTypeZeroCopy_g_sampleAccessInfo.getMemberValuePointerFcn =
+                interpreter::get_aggregation_value_pointer< ::ShapeTypeZeroCopy >;
+
+                ShapeTypeZeroCopy_g_sampleAccessInfo.languageBinding =
+                RTI_XCDR_TYPE_BINDING_CPP_11_STL ;
+
+                RTIXCdrHeap_freeStruct(sample);
+                is_initialized = RTI_TRUE;
+                return (RTIXCdrSampleAccessInfo*) &ShapeTypeZeroCopy_g_sampleAccessInfo;
+            }
+            static RTIXCdrTypePlugin * type_plugin_info()
+            {
+                static RTIXCdrTypePlugin ShapeTypeZeroCopy_g_typePlugin =
+                {
+                    NULL, /* serialize */
+                    NULL, /* serialize_key */
+                    NULL, /* deserialize_sample */
+                    NULL, /* deserialize_key_sample */
+                    NULL, /* skip */
+                    NULL, /* get_serialized_sample_size */
+                    NULL, /* get_serialized_sample_max_size_ex */
+                    NULL, /* get_serialized_key_max_size_ex */
+                    NULL, /* get_serialized_sample_min_size */
+                    NULL, /* serialized_sample_to_key */
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL,
+                    NULL
+                };
+
+                return &ShapeTypeZeroCopy_g_typePlugin;
+            }
+        }; // native_type_code
+
+        const ::dds::core::xtypes::StructType& dynamic_type< ::ShapeTypeZeroCopy >::get()
+        {
+            return static_cast<const ::dds::core::xtypes::StructType&>(
+                ::rti::core::native_conversions::cast_from_native< ::dds::core::xtypes::DynamicType >(
+                    *(native_type_code< ::ShapeTypeZeroCopy >::get())));
+        }
+    }
+}
+
+namespace dds {
+    namespace topic {
+        void topic_type_support< ::ShapeTypeZeroCopy >:: register_type(
+            ::dds::domain::DomainParticipant& participant,
+            const std::string& type_name)
+        {
+
+            ::rti::domain::register_type_plugin(
+                participant,
+                type_name,
+                ::ShapeTypeZeroCopyPlugin_new,
+                ::ShapeTypeZeroCopyPlugin_delete);
+        }
+
+        std::vector<char>& topic_type_support< ::ShapeTypeZeroCopy >::to_cdr_buffer(
+            std::vector<char>& buffer,
+            const ::ShapeTypeZeroCopy& sample,
+            ::dds::core::policy::DataRepresentationId representation)
+        {
+            // First get the length of the buffer
+            unsigned int length = 0;
+            RTIBool ok = ShapeTypeZeroCopyPlugin_serialize_to_cdr_buffer(
+                NULL,
+                &length,
+                &sample,
+                representation);
+            ::rti::core::check_return_code(
+                ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+                "Failed to calculate cdr buffer size");
+
+            // Create a vector with that size and copy the cdr buffer into it
+            buffer.resize(length);
+            ok = ShapeTypeZeroCopyPlugin_serialize_to_cdr_buffer(
+                &buffer[0],
+                &length,
+                &sample,
+                representation);
+            ::rti::core::check_return_code(
+                ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+                "Failed to copy cdr buffer");
+
+            return buffer;
+        }
+
+        void topic_type_support< ::ShapeTypeZeroCopy >::from_cdr_buffer(::ShapeTypeZeroCopy& sample,
+        const std::vector<char>& buffer)
+        {
+
+            RTIBool ok  = ShapeTypeZeroCopyPlugin_deserialize_from_cdr_buffer(
+                &sample,
+                &buffer[0],
+                static_cast<unsigned int>(buffer.size()));
+            ::rti::core::check_return_code(ok ? DDS_RETCODE_OK : DDS_RETCODE_ERROR,
+            "Failed to create ::ShapeTypeZeroCopy from cdr buffer");
+        }
+
+        void topic_type_support< ::ShapeTypeZeroCopy >::reset_sample(::ShapeTypeZeroCopy& sample)
+        {
+            ::rti::topic::reset_sample(sample.color());
+            sample.x(0);
+            sample.y(0);
+            sample.shapesize(0);
+            sample.fillKind(ShapeFillKind::SOLID_FILL);
+            sample.angle(0.0f);
+        }
+
+        void topic_type_support< ::ShapeTypeZeroCopy >::allocate_sample(::ShapeTypeZeroCopy& sample, int, int)
+        {
+            ::rti::topic::allocate_sample(sample.color(),  -1, -1);
+            ::rti::topic::allocate_sample(sample.fillKind(),  -1, -1);
+        }
+    }
+}
+
+#endif // NDDS_STANDALONE_TYPE
@@ -0,0 +1,256 @@
+
+
+/*
+WARNING: DO NOT MODIFY. Regenerate from shapes_zero_copy.idl instead.
+
+This file follows the output of RTI Code Generator (rtiddsgen) version 4.2.0
+for shapes_zero_copy.idl with -language C++11. The rtiddsgen tool is part of the
+RTI Connext DDS distribution; makefile_shapes_x64Linux4gcc7.3.0 has the
+command that regenerates it.
+*/
+
+#ifndef shapes_zero_copy_1752817254_hpp
+#define shapes_zero_copy_1752817254_hpp
+
+#include <iosfwd>
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, start exporting symbols.
+*/
+#undef RTIUSERDllExport
+#define RTIUSERDllExport __declspec(dllexport)
+#endif
+
+#include "dds/core/SafeEnumeration.hpp"
+#include "dds/core/String.hpp"
+#include "dds/core/array.hpp"
+#include "dds/core/vector.hpp"
+#include "dds/core/External.hpp"
+#include "rti/core/LongDouble.hpp"
+#include "rti/core/Pointer.hpp"
+#include "rti/core/array.hpp"
+#include "rti/topic/TopicTraits.hpp"
+
+#include "omg/types/string_view.hpp"
+
+#include "rti/core/BoundedSequence.hpp"
+#include "dds/core/Optional.hpp"
+
+#ifndef NDDS_STANDALONE_TYPE
+#include "dds/domain/DomainParticipant.hpp"
+#include "dds/topic/TopicTraits.hpp"
+#include "dds/core/xtypes/DynamicType.hpp"
+#include "dds/core/xtypes/StructType.hpp"
+#include "dds/core/xtypes/UnionType.hpp"
+#include "dds/core/xtypes/EnumType.hpp"
+#include "dds/core/xtypes/AliasType.hpp"
+#include "rti/util/StreamFlagSaver.hpp"
+#include "rti/domain/PluginSupport.hpp"
+#endif
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, stop exporting symbols.
+*/
+#undef RTIUSERDllExport
+#define RTIUSERDllExport
+#endif
+
+#include "shapes.hpp"
+
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, start exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport __declspec(dllexport)
+#endif
+
+class NDDSUSERDllExport ShapeTypeZeroCopy {
+  public:
+
+    ShapeTypeZeroCopy();
+
+    ShapeTypeZeroCopy(const ::dds::core::array< char, 128L>& color_,int32_t x_,int32_t y_,int32_t shapesize_,const ::ShapeFillKind& fillKind_,float angle_);
+
+    ::dds::core::array< char, 128L>& color() noexcept {
+        return m_color_;
+    }
+
+    const ::dds::core::array< char, 128L>& color() const noexcept {
+        return m_color_;
+    }
+
+    void color(const ::dds::core::array< char, 128L>& value) {
+
+        m_color_ = value;
+    }
+
+    void color(::dds::core::array< char, 128L>&& value) {
+        m_color_ = std::move(value);
+    }
+    int32_t& x() noexcept {
+        return m_x_;
+    }
+
+    const int32_t& x() const noexcept {
+        return m_x_;
+    }
+
+    void x(int32_t value) {
+
+        m_x_ = value;
+    }
+
+    int32_t& y() noexcept {
+        return m_y_;
+    }
+
+    const int32_t& y() const noexcept {
+        return m_y_;
+    }
+
+    void y(int32_t value) {
+
+        m_y_ = value;
+    }
+
+    int32_t& shapesize() noexcept {
+        return m_shapesize_;
+    }
+
+    const int32_t& shapesize() const noexcept {
+        return m_shapesize_;
+    }
+
+    void shapesize(int32_t value) {
+
+        m_shapesize_ = value;
+    }
+
+    ::ShapeFillKind& fillKind() noexcept {
+        return m_fillKind_;
+    }
+
+    const ::ShapeFillKind& fillKind() const noexcept {
+        return m_fillKind_;
+    }
+
+    void fillKind(const ::ShapeFillKind& value) {
+
+        m_fillKind_ = value;
+    }
+
+    void fillKind(::ShapeFillKind&& value) {
+        m_fillKind_ = std::move(value);
+    }
+    float& angle() noexcept {
+        return m_angle_;
+    }
+
+    const float& angle() const noexcept {
+        return m_angle_;
+    }
+
+    void angle(float value) {
+
+        m_angle_ = value;
+    }
+
+    bool operator == (const ShapeTypeZeroCopy& other_) const;
+    bool operator != (const ShapeTypeZeroCopy& other_) const;
+
+    void swap(ShapeTypeZeroCopy& other_) noexcept ;
+
+  private:
+
+    ::dds::core::array< char, 128L> m_color_;
+    int32_t m_x_;
+    int32_t m_y_;
+    int32_t m_shapesize_;
+    ::ShapeFillKind m_fillKind_;
+    float m_angle_;
+
+};
+
+inline void swap(ShapeTypeZeroCopy& a, ShapeTypeZeroCopy& b)  noexcept
+{
+    a.swap(b);
+}
+
+NDDSUSERDllExport std::ostream& operator<<(std::ostream& o, const ShapeTypeZeroCopy& sample);
+
+#ifndef NDDS_STANDALONE_TYPE
+
+namespace rti {
+    namespace flat {
+        namespace topic {
+        }
+    }
+}
+namespace dds {
+    namespace topic {
+
+        template<>
+        struct topic_type_name< ::ShapeTypeZeroCopy > {
+            NDDSUSERDllExport static std::string value() {
+                return "ShapeTypeZeroCopy";
+            }
+        };
+
+        template<>
+        struct is_topic_type< ::ShapeTypeZeroCopy > : public ::dds::core::true_type {};
+
+        template<>
+        struct topic_type_support< ::ShapeTypeZeroCopy > {
+            NDDSUSERDllExport
+            static void register_type(
+                ::dds::domain::DomainParticipant& participant,
+                const std::string & type_name);
+
+            NDDSUSERDllExport
+            static std::vector<char>& to_cdr_buffer(
+                std::vector<char>& buffer,
+                const ::ShapeTypeZeroCopy& sample,
+                ::dds::core::policy::DataRepresentationId representation
+                = ::dds::core::policy::DataRepresentation::auto_id());
+
+            NDDSUSERDllExport
+            static void from_cdr_buffer(::ShapeTypeZeroCopy& sample, const std::vector<char>& buffer);
+            NDDSUSERDllExport
+            static void reset_sample(::ShapeTypeZeroCopy& sample);
+
+            NDDSUSERDllExport
+            static void allocate_sample(::ShapeTypeZeroCopy& sample, int, int);
+
+            static const ::rti::topic::TypePluginKind::type type_plugin_kind =
+            ::rti::topic::TypePluginKind::STL;
+        };
+    }
+}
+
+namespace rti {
+    namespace topic {
+
+        template<>
+        struct dynamic_type< ::ShapeTypeZeroCopy > {
+            typedef ::dds::core::xtypes::StructType type;
+            NDDSUSERDllExport static const ::dds::core::xtypes::StructType& get();
+        };
+
+        template <>
+        struct extensibility< ::ShapeTypeZeroCopy > {
+            static const ::dds::core::xtypes::ExtensibilityKind::type kind =
+            ::dds::core::xtypes::ExtensibilityKind::FINAL;    };
+
+    }
+}
+
+#endif // NDDS_STANDALONE_TYPE
+#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
+/* If the code is building on Windows, stop exporting symbols.
+*/
+#undef NDDSUSERDllExport
+#define NDDSUSERDllExport
+#endif
+
+#endif // shapes_zero_copy_1752817254_hpp
+
@@ -0,0 +1,85 @@
+/*
+* (c) Copyright, Real-Time Innovations, 2020.  All rights reserved.
+* RTI grants Licensee a license to use, modify, compile, and create derivative
+* works of the software solely for use with RTI Connext DDS. Licensee may
+* redistribute copies of the software provided that all such copies are subject
+* to this license. The software is provided "as is", with no warranty of any
+* type, including any warranty for fitness for any purpose. RTI is under no
+* obligation to maintain or support the software. RTI shall not be liable for
+* any incidental or consequential damages arising out of the use or inability
+* to use the software.
+*/
+
+#ifndef STATS_REPORT_HPP
+#define STATS_REPORT_HPP
+
+#include <cstdio>
+
+// Machine-readable statistics lines, one record per line, either as JSON
+// objects or as CSV rows with a single header line.
+namespace stats_report {
+
+    enum class Format {
+        json,
+        csv
+    };
+
+    struct Record {
+        const char *type;     // "aggregate" or "instance"
+        double time;          // seconds since the application started
+        const char *key;      // instance key, empty for aggregates
+        double samples_per_second;
+        double bytes_per_second;  // received by the DataReader for
+                                  // aggregates, estimated for instances
+        unsigned long long instances;
+        unsigned long long state_changes;
+        double heap_allocs_per_second;       // whole process, aggregates only
+        unsigned long long latency_p50_us;   // latency percentiles since the
+        unsigned long long latency_p99_us;   // previous report for instances,
+                                             // since the application started
+                                             // for aggregates
+        unsigned long long latency_p999_us;
+        unsigned long long latency_max_us;
+    };
+
+    inline void print_header(Format format, FILE *out)
+    {
+        if (format == Format::csv)
+            fputs("type,time,key,samples_per_s,bytes_per_s,instances,state_changes,"
+                "heap_allocs_per_s,latency_p50_us,latency_p99_us,latency_p999_us,latency_max_us\n", out);
+    }
+
+    // Keys are written verbatim apart from the characters that would break
+    // the JSON string or the CSV field
+    inline void print_key(Format format, const char *key, FILE *out)
+    {
+        for (const char *c = key; *c != '\0'; ++c) {
+            if (format == Format::json && (*c == '"' || *c == '\\'))
+                fputc('\\', out);
+            if (format == Format::csv && (*c == ',' || *c == '\n'))
+                continue;
+            fputc(*c, out);
+        }
+    }
+
+    inline void print(Format format, const Record& record, FILE *out)
+    {
+        if (format == Format::json) {
+            fprintf(out, "{\"type\":\"%s\",\"time\":%.3f,\"key\":\"", record.type, record.time);
+            print_key(format, record.key, out);
+            fprintf(out, "\",\"samples_per_s\":%.1f,\"bytes_per_s\":%.1f,\"instances\":%llu,\"state_changes\":%llu,"
+                "\"heap_allocs_per_s\":%.1f,\"latency_p50_us\":%llu,\"latency_p99_us\":%llu,\"latency_p999_us\":%llu,\"latency_max_us\":%llu}\n",
+                record.samples_per_second, record.bytes_per_second, record.instances, record.state_changes,
+                record.heap_allocs_per_second, record.latency_p50_us, record.latency_p99_us, record.latency_p999_us, record.latency_max_us);
+        } else {
+            fprintf(out, "%s,%.3f,", record.type, record.time);
+            print_key(format, record.key, out);
+            fprintf(out, ",%.1f,%.1f,%llu,%llu,%.1f,%llu,%llu,%llu,%llu\n",
+                record.samples_per_second, record.bytes_per_second, record.instances, record.state_changes,
+                record.heap_allocs_per_second, record.latency_p50_us, record.latency_p99_us, record.latency_p999_us, record.latency_max_us);
+        }
+    }
+
+}  // namespace stats_report
+
+#endif  // STATS_REPORT_HPP